@@ -5,6 +5,13 @@
 #include "rsi_strategy.h"
 #include "supertrend_strategy.h"
 #include "combined_strategy.h"
+#include "chunked_strategy.h"
+#include "signal_cache.h"
+#include "signal_pipeline.h"
+#include "strategy_dispatch.h"
+#ifdef __linux__
+#include "shm_registry.h"
+#endif
 
 namespace py = pybind11;
 
@@ -16,8 +23,22 @@ PYBIND11_MODULE(bindings, m) {
         std::vector<double> macd_vec;
         std::vector<double> signal_vec;
 
-        // Call the C++ function with the additional parameters
-        calculate_macd(prices, macd_vec, signal_vec, short_period, long_period, signal_period);
+        // Call the C++ function with the additional parameters, going through the signal cache when enabled
+        if (signal_cache_enabled()) {
+            uint64_t key = indicator_cache_key({&prices}, "macd", {(double)short_period, (double)long_period, (double)signal_period});
+            std::vector<double> cached;
+            if (signal_cache_load(key, cached)) {
+                macd_vec.assign(cached.begin(), cached.begin() + cached.size() / 2);
+                signal_vec.assign(cached.begin() + cached.size() / 2, cached.end());
+            } else {
+                calculate_macd(prices, macd_vec, signal_vec, short_period, long_period, signal_period);
+                cached = macd_vec;
+                cached.insert(cached.end(), signal_vec.begin(), signal_vec.end());
+                signal_cache_store(key, cached);
+            }
+        } else {
+            calculate_macd(prices, macd_vec, signal_vec, short_period, long_period, signal_period);
+        }
 
         // Populate the Python lists with the results
         for (const auto& val : macd_vec) {
@@ -31,47 +52,175 @@ PYBIND11_MODULE(bindings, m) {
 
     // Expose run_macd_strategy
     m.def("run_macd_strategy", [](const std::string& csvFile, int short_period = 7, int long_period = 54, int signal_period = 8) {
-        return run_macd_strategy(csvFile.c_str(), short_period, long_period, signal_period);
+        return cached_strategy_signals(csvFile.c_str(), "macd", {(double)short_period, (double)long_period, (double)signal_period}, [&] {
+            return run_macd_strategy(csvFile.c_str(), short_period, long_period, signal_period);
+        });
     }, "Run the MACD strategy with dynamic parameters",
         py::arg("csvFile"), py::arg("short_period") = 7, py::arg("long_period") = 54, py::arg("signal_period") = 8);
 
     // Expose run_rsi_strategy
     m.def("run_rsi_strategy", [](const std::string& csvFile, int period = 4, int overbought = 99, int oversold = 43) {
-        return run_rsi_strategy(csvFile.c_str(), period, overbought, oversold);
+        return cached_strategy_signals(csvFile.c_str(), "rsi", {(double)period, (double)overbought, (double)oversold}, [&] {
+            return run_rsi_strategy(csvFile.c_str(), period, overbought, oversold);
+        });
     }, "Run the RSI strategy with dynamic parameters",
         py::arg("csvFile"), py::arg("period") = 4, py::arg("overbought") = 99, py::arg("oversold") = 43);
 
     // Expose run_supertrend_strategy
     m.def("run_supertrend_strategy", [](const std::string& csvFile, int period = 5, double multiplier = 8.5) {
-        return run_supertrend_strategy(csvFile.c_str(), period, multiplier);
+        return cached_strategy_signals(csvFile.c_str(), "supertrend", {(double)period, multiplier}, [&] {
+            return run_supertrend_strategy(csvFile.c_str(), period, multiplier);
+        });
     }, "Run the Supertrend strategy with dynamic parameters",
         py::arg("csvFile"), py::arg("period") = 5, py::arg("multiplier") = 8.5);
 
     // Expose combined strategies
-    m.def("run_macd_rsi_swing_strategy", &run_macd_rsi_swing_strategy, "Run MACD + RSI Swing Reversal Strategy",
+    m.def("run_macd_rsi_swing_strategy", [](const std::string& csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period) {
+        return cached_strategy_signals(csvFile.c_str(), "macd_rsi_swing", {(double)macd_short_period, (double)macd_long_period, (double)macd_signal_period, (double)rsi_period}, [&] {
+            return run_macd_rsi_swing_strategy(csvFile.c_str(), macd_short_period, macd_long_period, macd_signal_period, rsi_period);
+        });
+    }, "Run MACD + RSI Swing Reversal Strategy",
           py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
           py::arg("rsi_period"));
-    m.def("run_advanced_parameter_optimization_strategy", &run_advanced_parameter_optimization_strategy, "Run Advanced Parameter Optimization Strategy",
-          py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
-          py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
-    m.def("run_multi_timeframe_strategy", &run_multi_timeframe_strategy, "Run Multi-Timeframe Strategy",
+    m.def("run_advanced_parameter_optimization_strategy", [](const std::string& csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
+        return cached_strategy_signals(csvFile.c_str(), "advanced_parameter_optimization", {(double)macd_short_period, (double)macd_long_period, (double)macd_signal_period, (double)rsi_period, (double)supertrend_period, supertrend_multiplier}, [&] {
+            return run_advanced_parameter_optimization_strategy(csvFile.c_str(), macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+        });
+    }, "Run Advanced Parameter Optimization Strategy",
+            py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
+            py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
+    m.def("run_multi_timeframe_strategy", [](const std::string& csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
+        return cached_strategy_signals(csvFile.c_str(), "multi_timeframe", {(double)macd_short_period, (double)macd_long_period, (double)macd_signal_period, (double)rsi_period, (double)supertrend_period, supertrend_multiplier}, [&] {
+            return run_multi_timeframe_strategy(csvFile.c_str(), macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+        });
+    }, "Run Multi-Timeframe Strategy",
             py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
             py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
-    m.def("run_adaptive_ensemble_strategy", &run_adaptive_ensemble_strategy, "Run Adaptive Ensemble Strategy",
+    m.def("run_adaptive_ensemble_strategy", [](const std::string& csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
+        return cached_strategy_signals(csvFile.c_str(), "adaptive_ensemble", {(double)macd_short_period, (double)macd_long_period, (double)macd_signal_period, (double)rsi_period, (double)supertrend_period, supertrend_multiplier}, [&] {
+            return run_adaptive_ensemble_strategy(csvFile.c_str(), macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+        });
+    }, "Run Adaptive Ensemble Strategy",
             py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
             py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
-    m.def("run_dynamic_parameter_strategy", &run_dynamic_parameter_strategy, "Run Dynamic Parameter Strategy",
+    m.def("run_dynamic_parameter_strategy", [](const std::string& csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
+        return cached_strategy_signals(csvFile.c_str(), "dynamic_parameter", {(double)macd_short_period, (double)macd_long_period, (double)macd_signal_period, (double)rsi_period, (double)supertrend_period, supertrend_multiplier}, [&] {
+            return run_dynamic_parameter_strategy(csvFile.c_str(), macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+        });
+    }, "Run Dynamic Parameter Strategy",
             py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
             py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
-    m.def("run_mean_reversion_strategy", &run_mean_reversion_strategy, "Run Mean Reversion Strategy",
+    m.def("run_mean_reversion_strategy", [](const std::string& csvFile, int rsi_period, int supertrend_period, double supertrend_multiplier) {
+        return cached_strategy_signals(csvFile.c_str(), "mean_reversion", {(double)rsi_period, (double)supertrend_period, supertrend_multiplier}, [&] {
+            return run_mean_reversion_strategy(csvFile.c_str(), rsi_period, supertrend_period, supertrend_multiplier);
+        });
+    }, "Run Mean Reversion Strategy",
             py::arg("csvFile"), py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
-    m.def("run_momentum_breakout_strategy", &run_momentum_breakout_strategy, "Run Momentum Breakout Strategy",
+    m.def("run_momentum_breakout_strategy", [](const std::string& csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
+        return cached_strategy_signals(csvFile.c_str(), "momentum_breakout", {(double)macd_short_period, (double)macd_long_period, (double)macd_signal_period, (double)rsi_period, (double)supertrend_period, supertrend_multiplier}, [&] {
+            return run_momentum_breakout_strategy(csvFile.c_str(), macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+        });
+    }, "Run Momentum Breakout Strategy",
             py::arg("csvFile"), py::arg("macd_short_period"), py::arg("macd_long_period"), py::arg("macd_signal_period"),
             py::arg("rsi_period"), py::arg("supertrend_period"), py::arg("supertrend_multiplier"));
           
     // Expose calculateATR_exponential
-    m.def("calculateATR_exponential", &calculateATR_exponential, "Calculate ATR using exponential smoothing",
+    m.def("calculateATR_exponential", [](const std::vector<double>& high, const std::vector<double>& low, const std::vector<double>& close, int period) {
+        if (!signal_cache_enabled()) {
+            return calculateATR_exponential(high, low, close, period);
+        }
+        uint64_t key = indicator_cache_key({&high, &low, &close}, "atr_exponential", {(double)period});
+        std::vector<double> atr;
+        if (!signal_cache_load(key, atr)) {
+            atr = calculateATR_exponential(high, low, close, period);
+            signal_cache_store(key, atr);
+        }
+        return atr;
+    }, "Calculate ATR using exponential smoothing",
           py::arg("high"), py::arg("low"), py::arg("close"), py::arg("period"));
 
+    // Expose the persistent signal cache (opt-in)
+    m.def("enable_signal_cache", [](const std::string& directory, size_t max_bytes = DEFAULT_SIGNAL_CACHE_BYTES) {
+        return enable_signal_cache(directory.c_str(), max_bytes);
+    }, "Cache strategy signals and indicator vectors on disk, keyed by input content hash and parameters",
+        py::arg("directory"), py::arg("max_bytes") = DEFAULT_SIGNAL_CACHE_BYTES);
+    m.def("disable_signal_cache", &disable_signal_cache, "Stop using the persistent signal cache");
+
+    // Expose chunked (out-of-core) strategies
+    m.def("run_macd_strategy_chunked", [](const std::string& csvFile, const std::string& outFile, int short_period = 7, int long_period = 54, int signal_period = 8, size_t chunk_size = DEFAULT_CHUNK_SIZE) {
+        return run_macd_strategy_chunked(csvFile.c_str(), outFile.c_str(), short_period, long_period, signal_period, chunk_size);
+    }, "Run the MACD strategy in fixed-size blocks, writing signals to outFile",
+        py::arg("csvFile"), py::arg("outFile"), py::arg("short_period") = 7, py::arg("long_period") = 54, py::arg("signal_period") = 8,
+        py::arg("chunk_size") = DEFAULT_CHUNK_SIZE);
+    m.def("run_rsi_strategy_chunked", [](const std::string& csvFile, const std::string& outFile, int period = 4, int overbought = 99, int oversold = 43, size_t chunk_size = DEFAULT_CHUNK_SIZE) {
+        return run_rsi_strategy_chunked(csvFile.c_str(), outFile.c_str(), period, overbought, oversold, chunk_size);
+    }, "Run the RSI strategy in fixed-size blocks, writing signals to outFile",
+        py::arg("csvFile"), py::arg("outFile"), py::arg("period") = 4, py::arg("overbought") = 99, py::arg("oversold") = 43,
+        py::arg("chunk_size") = DEFAULT_CHUNK_SIZE);
+    m.def("run_supertrend_strategy_chunked", [](const std::string& csvFile, const std::string& outFile, int period = 5, double multiplier = 8.5, size_t chunk_size = DEFAULT_CHUNK_SIZE) {
+        return run_supertrend_strategy_chunked(csvFile.c_str(), outFile.c_str(), period, multiplier, chunk_size);
+    }, "Run the Supertrend strategy in fixed-size blocks, writing signals to outFile",
+        py::arg("csvFile"), py::arg("outFile"), py::arg("period") = 5, py::arg("multiplier") = 8.5,
+        py::arg("chunk_size") = DEFAULT_CHUNK_SIZE);
+
+    // Expose the native load -> indicators -> fusion -> inference pipeline
+    py::class_<StageMetrics>(m, "StageMetrics")
+        .def_readonly("name", &StageMetrics::name)
+        .def_readonly("batches", &StageMetrics::batches)
+        .def_readonly("symbols", &StageMetrics::symbols)
+        .def_readonly("busy_seconds", &StageMetrics::busy_seconds)
+        .def_readonly("input_wait_seconds", &StageMetrics::input_wait_seconds)
+        .def_readonly("output_wait_seconds", &StageMetrics::output_wait_seconds)
+        .def_property_readonly("throughput", &StageMetrics::throughput);
+    py::class_<PipelineResult>(m, "PipelineResult")
+        .def_readonly("symbols", &PipelineResult::symbols)
+        .def_readonly("predictions", &PipelineResult::predictions)
+        .def_readonly("stages", &PipelineResult::stages)
+        .def_readonly("wall_seconds", &PipelineResult::wall_seconds);
+    m.def("run_signal_pipeline", [](const std::vector<std::string>& csvFiles, const std::string& weightsFile, size_t batch_size = 8, size_t queue_capacity = 4) {
+        FusionModel model;
+        if (!model.load(weightsFile.c_str())) {
+            return PipelineResult();
+        }
+        py::gil_scoped_release release;
+        return run_signal_pipeline(csvFiles, model, FusionParams(), batch_size, queue_capacity);
+    }, "Score a universe of CSV files with overlapping load, indicator, fusion and inference stages",
+        py::arg("csvFiles"), py::arg("weightsFile"), py::arg("batch_size") = 8, py::arg("queue_capacity") = 4);
+
+    // Expose the shared-memory price registry (Linux only)
+#ifdef __linux__
+    m.def("shm_publish_series", [](const std::string& name, const std::string& csvFile) {
+        return shm_publish_series(name.c_str(), csvFile.c_str());
+    }, "Parse a CSV once and publish its OHLCV columns in shared memory under name",
+        py::arg("name"), py::arg("csvFile"));
+    m.def("shm_unpublish_series", [](const std::string& name) {
+        return shm_unpublish_series(name.c_str());
+    }, "Remove a published series and free its shared memory", py::arg("name"));
+    m.def("shm_list_series", &shm_list_series, "Names of the series currently published in shared memory");
+    m.def("run_strategy_shared", [](const std::string& name, const std::string& strategy, const std::vector<double>& params) {
+        std::vector<int> signals;
+        StrategyId id;
+        if (!strategy_from_name(strategy.c_str(), id)) {
+            std::cerr << "Unknown strategy: " << strategy << std::endl;
+            return signals;
+        }
+        std::shared_ptr<const SharedSeries> series = shm_attach_series(name.c_str());
+        if (!series) {
+            std::cerr << "Series not published: " << name << std::endl;
+            return signals;
+        }
+        bool valid;
+        {
+            py::gil_scoped_release release;
+            valid = run_strategy_on_series(id, series->prices(), params, signals);
+        }
+        if (!valid) {
+            throw py::value_error("Invalid parameters for " + strategy + " on a " + std::to_string(series->prices().close.size()) + "-row series");
+        }
+        return signals;
+    }, "Run a strategy directly on a series published in shared memory",
+        py::arg("name"), py::arg("strategy"), py::arg("params") = std::vector<double>());
+#endif
+
     // Expose additional strategies
 }
@@ -0,0 +1,287 @@
+#include "chunked_strategy.h"
+#include "supertrend_strategy.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+/*
+Chunked execution mode:
+- The CSV is read in blocks of chunk_size rows; the block buffers are reused between reads.
+- Each indicator keeps its recurrence state (EMA seeds, Wilder averages, Supertrend bands)
+  in a *StreamState struct, so a block boundary is invisible to the calculation.
+- The update steps use the same expressions, in the same order, as the serial loops of the
+  in-memory functions, so the written signals are identical to run_macd_strategy /
+  run_rsi_strategy / run_supertrend_strategy on files shorter than PARALLEL_SCAN_THRESHOLD rows.
+- On longer files the in-memory functions switch to the parallel scan, whose indicator values
+  agree with these recurrences only to within PARALLEL_SCAN_TOLERANCE (see parallel_scan.h).
+  Signals can then differ where a crossover or threshold test is a near tie.
+*/
+
+CsvChunkReader::CsvChunkReader(const char* csvFile, size_t chunk_size) : file(csvFile), chunk_size(chunk_size) {
+    if (chunk_size == 0) {
+        std::cerr << "Invalid chunk size: must be at least 1 row." << std::endl;
+        file.close();
+        return;
+    }
+    if (!file.is_open()) {
+        std::cerr << "Error opening file: " << csvFile << std::endl;
+        return;
+    }
+    std::string line;
+    std::getline(file, line); // Skip header
+}
+
+bool CsvChunkReader::next(std::vector<double>& high, std::vector<double>& low, std::vector<double>& close) {
+    high.clear();
+    low.clear();
+    close.clear();
+    std::string line;
+    while (close.size() < chunk_size && std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string token;
+        int col = 0;
+        double highPrice = 0.0, lowPrice = 0.0, closePrice = 0.0;
+        while (std::getline(ss, token, ',')) {
+            col++;
+            if (col == 2) closePrice = std::stod(token);  // 2nd column: Close
+            if (col == 3) highPrice = std::stod(token);   // 3rd column: High
+            if (col == 4) lowPrice = std::stod(token);    // 4th column: Low
+        }
+        high.push_back(highPrice);
+        low.push_back(lowPrice);
+        close.push_back(closePrice);
+    }
+    return !close.empty();
+}
+
+void MacdStreamState::update(double price, std::vector<int>& signals) {
+    size_t i = count++;
+
+    // Short and long EMA, seeded with the simple average of the first period
+    if (i < (size_t)short_period) {
+        short_sum += price;
+        if (i == (size_t)short_period - 1) short_ema = short_sum / short_period;
+    } else {
+        short_ema = (price - short_ema) * (2.0 / (short_period + 1)) + short_ema;
+    }
+    if (i < (size_t)long_period) {
+        long_sum += price;
+        if (i == (size_t)long_period - 1) long_ema = long_sum / long_period;
+    } else {
+        long_ema = (price - long_ema) * (2.0 / (long_period + 1)) + long_ema;
+    }
+
+    // MACD line starts at index long_period - 1
+    if (i + 1 < (size_t)long_period) return;
+    double macd = short_ema - long_ema;
+
+    // Signal line (EMA of MACD); zero until its seed is available
+    size_t k = macd_count++;
+    if (k < (size_t)signal_period) {
+        macd_sum += macd;
+        if (k == (size_t)signal_period - 1) signal = macd_sum / signal_period;
+    } else {
+        signal = (macd - signal) * (2.0 / (signal_period + 1)) + signal;
+    }
+
+    if (k > 0) {
+        if (prev_macd < prev_signal && macd > signal) {
+            state = 1; // Buy signal
+        } else if (prev_macd > prev_signal && macd < signal) {
+            state = -1; // Sell signal
+        }
+        signals.push_back(state);
+    }
+    prev_macd = macd;
+    prev_signal = signal;
+}
+
+void RsiStreamState::update(double price, std::vector<int>& signals) {
+    size_t i = count++;
+    if (i == 0) {
+        prev_price = price;
+        return;
+    }
+    double change = price - prev_price;
+    prev_price = price;
+
+    if (i <= (size_t)period) {
+        // Initial calculation: simple average gain and loss
+        if (change > 0)
+            gain += change;
+        else
+            loss += -change;
+        if (i < (size_t)period) return;
+        avg_gain = gain / period;
+        avg_loss = loss / period;
+    } else {
+        // Subsequent values using Wilder's smoothing
+        double current_gain = (change > 0) ? change : 0.0;
+        double current_loss = (change < 0) ? -change : 0.0;
+        avg_gain = (avg_gain * (period - 1) + current_gain) / period;
+        avg_loss = (avg_loss * (period - 1) + current_loss) / period;
+    }
+    double rs = (avg_loss == 0) ? 100 : avg_gain / avg_loss;
+    double rsi = 100 - (100 / (1 + rs));
+
+    // Signals start from the second computed RSI value
+    if (rsi_count++ == 0) return;
+    if (rsi < oversold) {
+        state = 1; // Buy signal
+    } else if (rsi > overbought) {
+        state = -1; // Sell signal
+    }
+    signals.push_back(state);
+}
+
+void SupertrendStreamState::update(double high, double low, double close, std::vector<int>& signals) {
+    size_t i = count++;
+    if (i == 0) {
+        prev_close = close;
+        pending_zeros++;
+        return;
+    }
+
+    // ATR: simple average of the first 'period' TR values, then exponential smoothing
+    double tr = trueRange(high, low, prev_close);
+    size_t t = tr_count++;
+    if (t < (size_t)period) {
+        tr_sum += tr;
+        if (t + 1 < (size_t)period) {
+            prev_close = close;
+            pending_zeros++;
+            return;
+        }
+        atr = tr_sum / period;
+    } else {
+        atr = (atr * (period - 1) + tr) / period;
+    }
+
+    double hl2 = (high + low) / 2.0;
+    double basicUpper = hl2 + multiplier * atr;
+    double basicLower = hl2 - multiplier * atr;
+    double currSupertrend;
+    if (i == (size_t)period) {
+        // For the first bar, final bands equal basic bands
+        final_upper = basicUpper;
+        final_lower = basicLower;
+        currSupertrend = (close <= basicUpper) ? basicUpper : basicLower;
+        signals.insert(signals.end(), pending_zeros, 0); // Insufficient data
+        pending_zeros = 0;
+    } else {
+        double prevFinalUpper = final_upper;
+        double prevFinalLower = final_lower;
+
+        double currFinalUpper = basicUpper;
+        if (basicUpper > prevFinalUpper && prev_close <= prevFinalUpper) {
+            currFinalUpper = prevFinalUpper;
+        }
+        double currFinalLower = basicLower;
+        if (basicLower < prevFinalLower && prev_close >= prevFinalLower) {
+            currFinalLower = prevFinalLower;
+        }
+
+        if (supertrend == prevFinalUpper) {
+            currSupertrend = (close <= currFinalUpper) ? currFinalUpper : currFinalLower;
+        } else {
+            currSupertrend = (close >= currFinalLower) ? currFinalLower : currFinalUpper;
+        }
+        final_upper = currFinalUpper;
+        final_lower = currFinalLower;
+    }
+    supertrend = currSupertrend;
+    prev_close = close;
+
+    state = (close > supertrend) ? 1 : -1;
+    signals.push_back(state);
+}
+
+// Appends a block of signals to the output file, one per line.
+static void write_signals(std::ofstream& out, std::vector<int>& signals) {
+    for (int s : signals) {
+        out << s << '\n';
+    }
+    signals.clear();
+}
+
+size_t run_macd_strategy_chunked(const char* csvFile, const char* outFile, int short_period, int long_period, int signal_period, size_t chunk_size) {
+    CsvChunkReader reader(csvFile, chunk_size);
+    if (!reader.is_open()) return 0;
+    std::ofstream out(outFile);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << outFile << std::endl;
+        return 0;
+    }
+
+    MacdStreamState macd(short_period, long_period, signal_period);
+    std::vector<double> high, low, close;
+    std::vector<int> signals;
+    size_t written = 0;
+    while (reader.next(high, low, close)) {
+        for (double price : close) {
+            macd.update(price, signals);
+        }
+        written += signals.size();
+        write_signals(out, signals);
+    }
+    if (macd.count == 0) {
+        std::cerr << "No price data available." << std::endl;
+    }
+    return written;
+}
+
+size_t run_rsi_strategy_chunked(const char* csvFile, const char* outFile, int period, int overbought, int oversold, size_t chunk_size) {
+    CsvChunkReader reader(csvFile, chunk_size);
+    if (!reader.is_open()) return 0;
+    std::ofstream out(outFile);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << outFile << std::endl;
+        return 0;
+    }
+
+    RsiStreamState rsi(period, overbought, oversold);
+    std::vector<double> high, low, close;
+    std::vector<int> signals;
+    size_t written = 0;
+    while (reader.next(high, low, close)) {
+        for (double price : close) {
+            rsi.update(price, signals);
+        }
+        written += signals.size();
+        write_signals(out, signals);
+    }
+    if (rsi.count == 0) {
+        std::cerr << "No price data available." << std::endl;
+    } else if (rsi.count < (size_t)period + 1) {
+        std::cerr << "Not enough data for RSI calculation." << std::endl;
+    }
+    return written;
+}
+
+size_t run_supertrend_strategy_chunked(const char* csvFile, const char* outFile, int period, double multiplier, size_t chunk_size) {
+    CsvChunkReader reader(csvFile, chunk_size);
+    if (!reader.is_open()) return 0;
+    std::ofstream out(outFile);
+    if (!out.is_open()) {
+        std::cerr << "Error opening file: " << outFile << std::endl;
+        return 0;
+    }
+
+    SupertrendStreamState supertrend(period, multiplier);
+    std::vector<double> high, low, close;
+    std::vector<int> signals;
+    size_t written = 0;
+    while (reader.next(high, low, close)) {
+        for (size_t i = 0; i < close.size(); ++i) {
+            supertrend.update(high[i], low[i], close[i], signals);
+        }
+        written += signals.size();
+        write_signals(out, signals);
+    }
+    if (supertrend.count < (size_t)period + 1) {
+        std::cerr << "Not enough data for Supertrend calculation." << std::endl;
+    }
+    return written;
+}
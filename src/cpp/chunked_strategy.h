@@ -0,0 +1,90 @@
+#ifndef CHUNKED_STRATEGY_H
+#define CHUNKED_STRATEGY_H
+
+#include <vector>
+#include <fstream>
+#include <cstddef>
+
+// Default number of rows read per block in chunked mode.
+const size_t DEFAULT_CHUNK_SIZE = 65536;
+
+// Streams the Close, High and Low columns of a CSV file in fixed-size blocks.
+// Column layout matches readPricesSupertrend (Date, Close, High, Low, ...).
+class CsvChunkReader {
+public:
+    // A chunk_size of 0 is rejected: the reader reports it and stays closed.
+    CsvChunkReader(const char* csvFile, size_t chunk_size);
+
+    bool is_open() const { return file.is_open(); }
+
+    // Reads up to chunk_size rows into the given vectors (cleared first).
+    // Returns false once the file is exhausted and no rows were read.
+    bool next(std::vector<double>& high, std::vector<double>& low, std::vector<double>& close);
+
+private:
+    std::ifstream file;
+    size_t chunk_size;
+};
+
+// MACD recurrence state carried across block boundaries.
+// Produces exactly the signals of run_macd_strategy on series shorter than PARALLEL_SCAN_THRESHOLD.
+struct MacdStreamState {
+    int short_period, long_period, signal_period;
+    size_t count = 0;
+    double short_sum = 0.0, long_sum = 0.0;
+    double short_ema = 0.0, long_ema = 0.0;
+    size_t macd_count = 0;
+    double macd_sum = 0.0, signal = 0.0;
+    double prev_macd = 0.0, prev_signal = 0.0;
+    int state = 0;
+
+    MacdStreamState(int short_period, int long_period, int signal_period)
+        : short_period(short_period), long_period(long_period), signal_period(signal_period) {}
+
+    void update(double price, std::vector<int>& signals);
+};
+
+// Wilder RSI recurrence state carried across block boundaries.
+// Produces exactly the signals of run_rsi_strategy on series shorter than PARALLEL_SCAN_THRESHOLD.
+struct RsiStreamState {
+    int period, overbought, oversold;
+    size_t count = 0;
+    double prev_price = 0.0;
+    double gain = 0.0, loss = 0.0;
+    double avg_gain = 0.0, avg_loss = 0.0;
+    size_t rsi_count = 0;
+    int state = 0;
+
+    RsiStreamState(int period, int overbought, int oversold)
+        : period(period), overbought(overbought), oversold(oversold) {}
+
+    void update(double price, std::vector<int>& signals);
+};
+
+// ATR + Supertrend band recurrence state carried across block boundaries.
+// Produces exactly the signals of run_supertrend_strategy on series shorter than PARALLEL_SCAN_THRESHOLD.
+struct SupertrendStreamState {
+    int period;
+    double multiplier;
+    size_t count = 0;
+    double prev_close = 0.0;
+    size_t tr_count = 0;
+    double tr_sum = 0.0, atr = 0.0;
+    double final_upper = 0.0, final_lower = 0.0, supertrend = 0.0;
+    size_t pending_zeros = 0; // Leading "insufficient data" signals, held until the first band exists
+    int state = 0;
+
+    SupertrendStreamState(int period, double multiplier) : period(period), multiplier(multiplier) {}
+
+    void update(double high, double low, double close, std::vector<int>& signals);
+};
+
+// Chunked variants of the single-indicator strategies. The input is streamed in blocks of
+// chunk_size rows and signals are appended to outFile (one per line) as each block completes,
+// so peak memory is bounded by chunk_size rather than by the length of the history.
+// Returns the number of signals written (0, without touching outFile, if chunk_size is 0).
+size_t run_macd_strategy_chunked(const char* csvFile, const char* outFile, int short_period, int long_period, int signal_period, size_t chunk_size);
+size_t run_rsi_strategy_chunked(const char* csvFile, const char* outFile, int period, int overbought, int oversold, size_t chunk_size);
+size_t run_supertrend_strategy_chunked(const char* csvFile, const char* outFile, int period, double multiplier, size_t chunk_size);
+
+#endif // CHUNKED_STRATEGY_H
@@ -0,0 +1,108 @@
+#include "chunked_strategy.h"
+#include "macd_strategy.h"
+#include "rsi_strategy.h"
+#include "supertrend_strategy.h"
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <cstdio>
+
+/*
+Checks that the chunked strategies write exactly the signals of the in-memory strategies.
+The inputs must be shorter than PARALLEL_SCAN_THRESHOLD rows (see chunked_strategy.cpp).
+
+Usage (from the repository root):
+    g++ -std=c++17 -O2 -pthread src/cpp/chunked_strategy_test.cpp src/cpp/chunked_strategy.cpp src/cpp/macd_strategy.cpp src/cpp/rsi_strategy.cpp src/cpp/supertrend_strategy.cpp src/cpp/parallel_scan.cpp -o chunked_strategy_test
+    ./chunked_strategy_test [data/AAPL_training.csv data/AAPL_testing.csv]
+
+Every parameter set is run with chunk sizes 1, period - 1, period, period + 1 (for each of its
+periods) and DEFAULT_CHUNK_SIZE, so block boundaries fall inside and right at every seed window.
+Also checks that chunk_size 0 is rejected. Exits with status 1 on the first mismatch.
+*/
+
+namespace {
+
+const char* const OUTPUT_FILE = "chunked_strategy_test.out";
+
+std::vector<int> read_signals(const char* file) {
+    std::vector<int> signals;
+    std::ifstream in(file);
+    int value;
+    while (in >> value) signals.push_back(value);
+    return signals;
+}
+
+std::set<size_t> chunk_sizes(const std::vector<int>& periods) {
+    std::set<size_t> sizes = {1, DEFAULT_CHUNK_SIZE};
+    for (int p : periods) {
+        if (p > 1) sizes.insert((size_t)p - 1);
+        sizes.insert((size_t)p);
+        sizes.insert((size_t)p + 1);
+    }
+    return sizes;
+}
+
+bool check(const std::string& label, size_t chunk_size, size_t written, const std::vector<int>& expected) {
+    std::vector<int> chunked = read_signals(OUTPUT_FILE);
+    if (written == expected.size() && chunked == expected) return true;
+    std::cerr << "FAIL " << label << " chunk_size=" << chunk_size << ": " << chunked.size()
+              << " chunked signals vs " << expected.size() << " in memory" << std::endl;
+    return false;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::vector<std::string> files;
+    for (int i = 1; i < argc; ++i) files.push_back(argv[i]);
+    if (files.empty()) files = {"data/AAPL_training.csv", "data/AAPL_testing.csv"};
+
+    // Defaults from bindings.cpp plus the textbook settings
+    const int macd_params[][3] = {{7, 54, 8}, {12, 26, 9}};
+    const int rsi_params[][3] = {{4, 99, 43}, {14, 70, 30}};
+    const double supertrend_params[][2] = {{5, 8.5}, {10, 3.0}};
+
+    size_t checks = 0;
+    for (const std::string& file : files) {
+        const char* csv = file.c_str();
+        if (!std::ifstream(csv).is_open()) {
+            std::cerr << "Error opening file: " << file << std::endl;
+            return 1;
+        }
+
+        for (const auto& p : macd_params) {
+            std::vector<int> expected = run_macd_strategy(csv, p[0], p[1], p[2]);
+            for (size_t cs : chunk_sizes({p[0], p[1], p[2]})) {
+                size_t written = run_macd_strategy_chunked(csv, OUTPUT_FILE, p[0], p[1], p[2], cs);
+                if (!check(file + " macd", cs, written, expected)) return 1;
+                ++checks;
+            }
+        }
+        for (const auto& p : rsi_params) {
+            std::vector<int> expected = run_rsi_strategy(csv, p[0], p[1], p[2]);
+            for (size_t cs : chunk_sizes({p[0]})) {
+                size_t written = run_rsi_strategy_chunked(csv, OUTPUT_FILE, p[0], p[1], p[2], cs);
+                if (!check(file + " rsi", cs, written, expected)) return 1;
+                ++checks;
+            }
+        }
+        for (const auto& p : supertrend_params) {
+            std::vector<int> expected = run_supertrend_strategy(csv, (int)p[0], p[1]);
+            for (size_t cs : chunk_sizes({(int)p[0]})) {
+                size_t written = run_supertrend_strategy_chunked(csv, OUTPUT_FILE, (int)p[0], p[1], cs);
+                if (!check(file + " supertrend", cs, written, expected)) return 1;
+                ++checks;
+            }
+        }
+    }
+    // A zero chunk size must be rejected before outFile is created
+    std::remove(OUTPUT_FILE);
+    if (run_macd_strategy_chunked(files[0].c_str(), OUTPUT_FILE, 7, 54, 8, 0) != 0 || std::ifstream(OUTPUT_FILE).is_open()) {
+        std::cerr << "FAIL chunk_size=0 was not rejected" << std::endl;
+        return 1;
+    }
+    std::cout << "chunked_strategy_test: " << checks << " runs match the in-memory strategies" << std::endl;
+    return 0;
+}
@@ -13,6 +13,10 @@ std::vector<double> readPrices(const char* csvFile);
 // MACD + RSI Swing Reversal Strategy
 std::vector<int> run_macd_rsi_swing_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period) {
     std::vector<double> prices = readPrices(csvFile);
+    return generate_macd_rsi_swing_signals(prices, macd_short_period, macd_long_period, macd_signal_period, rsi_period);
+}
+
+std::vector<int> generate_macd_rsi_swing_signals(SeriesView prices, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period) {
     std::vector<double> macd, signal, rsi_values;
 
     // Calculate MACD
@@ -47,7 +51,10 @@ std::vector<int> run_macd_rsi_swing_strategy(const char* csvFile, int macd_short
 std::vector<int> run_advanced_parameter_optimization_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_advanced_parameter_optimization_signals(high, low, close, macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+}
 
+std::vector<int> generate_advanced_parameter_optimization_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     if (close.size() < 20) {
         std::cerr << "Not enough data for Advanced Parameter Optimization Strategy." << std::endl;
         return {};
@@ -56,7 +63,7 @@ std::vector<int> run_advanced_parameter_optimization_strategy(const char* csvFil
     std::vector<double> macd, signal, rsi_values;
     calculate_macd(close, macd, signal, macd_short_period, macd_long_period, macd_signal_period);
     calculate_rsi(close, rsi_values, rsi_period);
-    std::vector<int> supertrend_signals = run_supertrend_strategy(csvFile, supertrend_period, supertrend_multiplier);
+    std::vector<int> supertrend_signals = generate_supertrend_signals(high, low, close, supertrend_period, supertrend_multiplier);
 
     std::vector<int> optimized_signals;
     int state = 0;
@@ -84,7 +91,10 @@ std::vector<int> run_advanced_parameter_optimization_strategy(const char* csvFil
 std::vector<int> run_mean_reversion_strategy(const char* csvFile, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_mean_reversion_signals(high, low, close, rsi_period, supertrend_period, supertrend_multiplier);
+}
 
+std::vector<int> generate_mean_reversion_signals(SeriesView high, SeriesView low, SeriesView close, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     if (close.size() < 20) {
         std::cerr << "Not enough data for Mean Reversion Strategy." << std::endl;
         return {};
@@ -120,7 +130,10 @@ std::vector<int> run_mean_reversion_strategy(const char* csvFile, int rsi_period
 std::vector<int> run_momentum_breakout_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_momentum_breakout_signals(high, low, close, macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+}
 
+std::vector<int> generate_momentum_breakout_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<int> signals; 
 
     if (close.size() < 20) {
@@ -152,7 +165,10 @@ std::vector<int> run_momentum_breakout_strategy(const char* csvFile, int macd_sh
 std::vector<int> run_multi_timeframe_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_multi_timeframe_signals(high, low, close, macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+}
 
+std::vector<int> generate_multi_timeframe_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     if (close.size() < 200) {
         std::cerr << "Not enough data for Multi-Timeframe Strategy." << std::endl;
         return {};
@@ -190,7 +206,10 @@ std::vector<int> run_multi_timeframe_strategy(const char* csvFile, int macd_shor
 std::vector<int> run_adaptive_ensemble_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_adaptive_ensemble_signals(high, low, close, macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+}
 
+std::vector<int> generate_adaptive_ensemble_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     if (close.size() < 20) {
         std::cerr << "Not enough data for Adaptive Ensemble Strategy." << std::endl;
         return {};
@@ -231,7 +250,10 @@ std::vector<int> run_adaptive_ensemble_strategy(const char* csvFile, int macd_sh
 std::vector<int> run_dynamic_parameter_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_dynamic_parameter_signals(high, low, close, macd_short_period, macd_long_period, macd_signal_period, rsi_period, supertrend_period, supertrend_multiplier);
+}
 
+std::vector<int> generate_dynamic_parameter_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier) {
     if (close.size() < 20) {
         std::cerr << "Not enough data for Dynamic Parameter Strategy." << std::endl;
         return {};
@@ -2,6 +2,7 @@
 #define COMBINED_STRATEGY_H
 
 #include <vector>
+#include "data_types.h"
 
 std::vector<int> run_macd_rsi_swing_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period);
 std::vector<int> run_advanced_parameter_optimization_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
@@ -11,4 +12,13 @@ std::vector<int> run_multi_timeframe_strategy(const char* csvFile, int macd_shor
 std::vector<int> run_adaptive_ensemble_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
 std::vector<int> run_dynamic_parameter_strategy(const char* csvFile, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
 
+// Signal generators on in-memory series; the run_* functions above read the CSV and call these.
+std::vector<int> generate_macd_rsi_swing_signals(SeriesView prices, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period);
+std::vector<int> generate_advanced_parameter_optimization_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
+std::vector<int> generate_mean_reversion_signals(SeriesView high, SeriesView low, SeriesView close, int rsi_period, int supertrend_period, double supertrend_multiplier);
+std::vector<int> generate_momentum_breakout_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
+std::vector<int> generate_multi_timeframe_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
+std::vector<int> generate_adaptive_ensemble_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
+std::vector<int> generate_dynamic_parameter_signals(SeriesView high, SeriesView low, SeriesView close, int macd_short_period, int macd_long_period, int macd_signal_period, int rsi_period, int supertrend_period, double supertrend_multiplier);
+
 #endif // COMBINED_STRATEGY_H
\ No newline at end of file
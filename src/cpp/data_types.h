@@ -1,6 +1,9 @@
 #ifndef DATA_TYPES_H
 #define DATA_TYPES_H
 
+#include <vector>
+#include <cstddef>
+
 // Structure for a candlestick data point
 struct Candle {
     double open;
@@ -10,4 +13,40 @@ struct Candle {
     double volume;
 };
 
+// Columnar High/Low/Close series as produced by readPricesSupertrend
+struct PriceSeries {
+    std::vector<double> high;
+    std::vector<double> low;
+    std::vector<double> close;
+};
+
+// Read-only view of a contiguous price column. Converts implicitly from std::vector<double>, so the
+// indicator functions accept both owned vectors and externally owned memory such as shared memory.
+struct SeriesView {
+    const double* ptr = nullptr;
+    size_t length = 0;
+
+    SeriesView() {}
+    SeriesView(const double* data, size_t size) : ptr(data), length(size) {}
+    SeriesView(const std::vector<double>& v) : ptr(v.data()), length(v.size()) {}
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    const double* data() const { return ptr; }
+    const double* begin() const { return ptr; }
+    const double* end() const { return ptr + length; }
+    const double& operator[](size_t i) const { return ptr[i]; }
+};
+
+// Read-only High/Low/Close views, e.g. over a PriceSeries or a shared-memory block
+struct PriceSeriesView {
+    SeriesView high;
+    SeriesView low;
+    SeriesView close;
+
+    PriceSeriesView() {}
+    PriceSeriesView(SeriesView high, SeriesView low, SeriesView close) : high(high), low(low), close(close) {}
+    PriceSeriesView(const PriceSeries& series) : high(series.high), low(series.low), close(series.close) {}
+};
+
 #endif // DATA_TYPES_H
@@ -0,0 +1,141 @@
+#include "fusion_model.h"
+#include "macd_strategy.h"
+#include "rsi_strategy.h"
+#include "supertrend_strategy.h"
+#include "combined_strategy.h"
+#include <iostream>
+#include <fstream>
+#include <vector>
+#include <string>
+#include <cmath>
+#include <algorithm>
+
+/*
+Weights file format (text, whitespace separated), written by src/python/export_weights.py:
+    fusion-mlp <num_layers>
+    then per Dense layer:
+    <in> <out> <activation>
+    <in * out kernel values, row-major>
+    <out bias values>
+Supported activations: linear, relu, sigmoid, softmax.
+*/
+
+std::vector<std::vector<int>> compute_strategy_signals(const PriceSeriesView& series, const FusionParams& p) {
+    SeriesView high = series.high;
+    SeriesView low = series.low;
+    SeriesView close = series.close;
+    return {
+        generate_macd_signals(close, p.macd_short_period, p.macd_long_period, p.macd_signal_period),
+        generate_rsi_signals(close, p.rsi_period, p.rsi_overbought, p.rsi_oversold),
+        generate_supertrend_signals(high, low, close, p.supertrend_period, p.supertrend_multiplier),
+        generate_macd_rsi_swing_signals(close, p.macd_short_period, p.macd_long_period, p.macd_signal_period, p.rsi_period),
+        generate_advanced_parameter_optimization_signals(high, low, close, p.macd_short_period, p.macd_long_period, p.macd_signal_period, p.rsi_period, p.supertrend_period, p.supertrend_multiplier),
+        generate_adaptive_ensemble_signals(high, low, close, p.macd_short_period, p.macd_long_period, p.macd_signal_period, p.rsi_period, p.supertrend_period, p.supertrend_multiplier),
+        generate_mean_reversion_signals(high, low, close, p.rsi_period, p.supertrend_period, p.supertrend_multiplier),
+        generate_momentum_breakout_signals(high, low, close, p.macd_short_period, p.macd_long_period, p.macd_signal_period, p.rsi_period, p.supertrend_period, p.supertrend_multiplier),
+        generate_multi_timeframe_signals(high, low, close, p.macd_short_period, p.macd_long_period, p.macd_signal_period, p.rsi_period, p.supertrend_period, p.supertrend_multiplier),
+    };
+}
+
+std::vector<double> fuse_signals(const std::vector<std::vector<int>>& signals, size_t series_length, size_t& rows) {
+    // Truncate all signal vectors to the shortest length, keeping the most recent values
+    rows = series_length;
+    for (const std::vector<int>& s : signals) {
+        rows = std::min(rows, s.size());
+    }
+    std::vector<double> features(rows * signals.size());
+    for (size_t f = 0; f < signals.size(); ++f) {
+        size_t offset = signals[f].size() - rows;
+        for (size_t r = 0; r < rows; ++r) {
+            features[r * signals.size() + f] = signals[f][offset + r];
+        }
+    }
+    return features;
+}
+
+bool FusionModel::load(const char* weightsFile) {
+    layers.clear();
+    std::ifstream file(weightsFile);
+    if (!file.is_open()) {
+        std::cerr << "Error opening file: " << weightsFile << std::endl;
+        return false;
+    }
+    std::string tag;
+    size_t num_layers = 0;
+    if (!(file >> tag >> num_layers) || tag != "fusion-mlp") {
+        std::cerr << "Invalid fusion model weights: " << weightsFile << std::endl;
+        return false;
+    }
+
+    std::vector<DenseLayer> loaded_layers;
+    for (size_t l = 0; l < num_layers; ++l) {
+        DenseLayer layer;
+        if (!(file >> layer.in >> layer.out >> layer.activation) ||
+            (!loaded_layers.empty() && loaded_layers.back().out != layer.in)) {
+            std::cerr << "Invalid fusion model weights: " << weightsFile << std::endl;
+            return false;
+        }
+        layer.weights.resize(layer.in * layer.out);
+        layer.bias.resize(layer.out);
+        for (double& w : layer.weights) file >> w;
+        for (double& b : layer.bias) file >> b;
+        if (!file) {
+            std::cerr << "Truncated fusion model weights: " << weightsFile << std::endl;
+            return false;
+        }
+        if (layer.activation != "linear" && layer.activation != "relu" &&
+            layer.activation != "sigmoid" && layer.activation != "softmax") {
+            std::cerr << "Unsupported activation in fusion model: " << layer.activation << std::endl;
+            return false;
+        }
+        loaded_layers.push_back(std::move(layer));
+    }
+    layers = std::move(loaded_layers);
+    return true;
+}
+
+std::vector<double> FusionModel::predict_proba(const std::vector<double>& features, size_t rows) const {
+    std::vector<double> input(features.begin(), features.begin() + rows * input_dim());
+    std::vector<double> output;
+    for (const DenseLayer& layer : layers) {
+        output.assign(rows * layer.out, 0.0);
+        for (size_t r = 0; r < rows; ++r) {
+            const double* x = &input[r * layer.in];
+            double* y = &output[r * layer.out];
+            std::copy(layer.bias.begin(), layer.bias.end(), y);
+            for (size_t i = 0; i < layer.in; ++i) {
+                const double* w = &layer.weights[i * layer.out];
+                for (size_t o = 0; o < layer.out; ++o) {
+                    y[o] += x[i] * w[o];
+                }
+            }
+
+            if (layer.activation == "relu") {
+                for (size_t o = 0; o < layer.out; ++o) y[o] = std::max(0.0, y[o]);
+            } else if (layer.activation == "sigmoid") {
+                for (size_t o = 0; o < layer.out; ++o) y[o] = 1.0 / (1.0 + std::exp(-y[o]));
+            } else if (layer.activation == "softmax") {
+                double max_val = *std::max_element(y, y + layer.out);
+                double sum = 0.0;
+                for (size_t o = 0; o < layer.out; ++o) {
+                    y[o] = std::exp(y[o] - max_val);
+                    sum += y[o];
+                }
+                for (size_t o = 0; o < layer.out; ++o) y[o] /= sum;
+            }
+        }
+        input.swap(output);
+    }
+    return input;
+}
+
+std::vector<int> FusionModel::predict(const std::vector<double>& features, size_t rows) const {
+    std::vector<double> proba = predict_proba(features, rows);
+    size_t classes = output_dim();
+    std::vector<int> predictions(rows);
+    for (size_t r = 0; r < rows; ++r) {
+        const double* p = &proba[r * classes];
+        predictions[r] = (int)(std::max_element(p, p + classes) - p) - 1; // Shift 0, 1, 2 back to -1, 0, 1
+    }
+    return predictions;
+}
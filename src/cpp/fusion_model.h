@@ -0,0 +1,58 @@
+#ifndef FUSION_MODEL_H
+#define FUSION_MODEL_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "data_types.h"
+
+// Number of strategy signals fed to the fusion network (columns of nn_*_dataset.csv).
+const size_t NUM_FUSION_FEATURES = 9;
+
+// Strategy parameters used to build the fusion features. Defaults match generate_dataset.py.
+struct FusionParams {
+    int macd_short_period = 7;
+    int macd_long_period = 54;
+    int macd_signal_period = 8;
+    int rsi_period = 4;
+    int rsi_overbought = 99;
+    int rsi_oversold = 43;
+    int supertrend_period = 5;
+    double supertrend_multiplier = 8.5;
+};
+
+// Computes the nine strategy signal vectors, in the column order of generate_dataset.py.
+std::vector<std::vector<int>> compute_strategy_signals(const PriceSeriesView& series, const FusionParams& params);
+
+// Aligns the signal vectors on their common trailing window (as generate_dataset.py does) and
+// returns row-major feature rows. 'rows' receives the number of rows.
+std::vector<double> fuse_signals(const std::vector<std::vector<int>>& signals, size_t series_length, size_t& rows);
+
+// Dense feed-forward network evaluated natively. Weights come from export_weights.py, which dumps
+// the Dense layers of models/nn_model_weights.h5; Dropout layers are identity at inference.
+class FusionModel {
+public:
+    // Loads a weights file; returns false (and leaves the model empty) on a malformed file.
+    bool load(const char* weightsFile);
+
+    bool loaded() const { return !layers.empty(); }
+    size_t input_dim() const { return layers.empty() ? 0 : layers.front().in; }
+    size_t output_dim() const { return layers.empty() ? 0 : layers.back().out; }
+
+    // Output activations for each feature row, row-major (rows x output_dim).
+    std::vector<double> predict_proba(const std::vector<double>& features, size_t rows) const;
+
+    // Predicted trade direction per row: -1 short, 0 no trade, 1 long (argmax - 1, as in test.py).
+    std::vector<int> predict(const std::vector<double>& features, size_t rows) const;
+
+private:
+    struct DenseLayer {
+        size_t in, out;
+        std::string activation;
+        std::vector<double> weights; // in x out, row-major (Keras kernel layout)
+        std::vector<double> bias;
+    };
+    std::vector<DenseLayer> layers;
+};
+
+#endif // FUSION_MODEL_H
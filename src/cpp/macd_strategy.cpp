@@ -1,4 +1,5 @@
 #include "macd_strategy.h"
+#include "parallel_scan.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -40,7 +41,7 @@ double calculate_ema(const std::vector<double>& prices, int period, int index, d
 }
 
 // Calculates the MACD line and Signal line
-void calculate_macd(const std::vector<double>& prices, std::vector<double>& macd, std::vector<double>& signal, int short_period, int long_period, int signal_period) {
+void calculate_macd(SeriesView prices, std::vector<double>& macd, std::vector<double>& signal, int short_period, int long_period, int signal_period) {
     std::vector<double> short_ema(prices.size(), 0.0);
     std::vector<double> long_ema(prices.size(), 0.0);
 
@@ -48,12 +49,20 @@ void calculate_macd(const std::vector<double>& prices, std::vector<double>& macd
     short_ema[short_period - 1] = std::accumulate(prices.begin(), prices.begin() + short_period, 0.0) / short_period;
     long_ema[long_period - 1] = std::accumulate(prices.begin(), prices.begin() + long_period, 0.0) / long_period;
 
-    // Calculate EMA for the rest of the prices
-    for (size_t i = short_period; i < prices.size(); ++i) {
-        short_ema[i] = (prices[i] - short_ema[i - 1]) * (2.0 / (short_period + 1)) + short_ema[i - 1];
+    // Calculate EMA for the rest of the prices (parallel scan for very long series)
+    if (prices.size() >= short_period + PARALLEL_SCAN_THRESHOLD) {
+        parallel_ema(&prices[short_period], &short_ema[short_period], prices.size() - short_period, 2.0 / (short_period + 1), short_ema[short_period - 1]);
+    } else {
+        for (size_t i = short_period; i < prices.size(); ++i) {
+            short_ema[i] = (prices[i] - short_ema[i - 1]) * (2.0 / (short_period + 1)) + short_ema[i - 1];
+        }
     }
-    for (size_t i = long_period; i < prices.size(); ++i) {
-        long_ema[i] = (prices[i] - long_ema[i - 1]) * (2.0 / (long_period + 1)) + long_ema[i - 1];
+    if (prices.size() >= long_period + PARALLEL_SCAN_THRESHOLD) {
+        parallel_ema(&prices[long_period], &long_ema[long_period], prices.size() - long_period, 2.0 / (long_period + 1), long_ema[long_period - 1]);
+    } else {
+        for (size_t i = long_period; i < prices.size(); ++i) {
+            long_ema[i] = (prices[i] - long_ema[i - 1]) * (2.0 / (long_period + 1)) + long_ema[i - 1];
+        }
     }
 
     // Calculate MACD line (starting from index long_period - 1)
@@ -64,8 +73,12 @@ void calculate_macd(const std::vector<double>& prices, std::vector<double>& macd
     // Calculate Signal line (EMA of MACD)
     signal.resize(macd.size(), 0.0);
     signal[signal_period - 1] = std::accumulate(macd.begin(), macd.begin() + signal_period, 0.0) / signal_period;
-    for (size_t i = signal_period; i < macd.size(); ++i) {
-        signal[i] = (macd[i] - signal[i - 1]) * (2.0 / (signal_period + 1)) + signal[i - 1];
+    if (macd.size() >= signal_period + PARALLEL_SCAN_THRESHOLD) {
+        parallel_ema(&macd[signal_period], &signal[signal_period], macd.size() - signal_period, 2.0 / (signal_period + 1), signal[signal_period - 1]);
+    } else {
+        for (size_t i = signal_period; i < macd.size(); ++i) {
+            signal[i] = (macd[i] - signal[i - 1]) * (2.0 / (signal_period + 1)) + signal[i - 1];
+        }
     }
 }
 
@@ -75,7 +88,11 @@ std::vector<int> run_macd_strategy(const char* csvFile, int short_period, int lo
         std::cerr << "No price data available." << std::endl;
         return {};
     }
+    return generate_macd_signals(prices, short_period, long_period, signal_period);
+}
 
+// Generates MACD crossover signals from closing prices
+std::vector<int> generate_macd_signals(SeriesView prices, int short_period, int long_period, int signal_period) {
     std::vector<double> macd, signal;
     calculate_macd(prices, macd, signal, short_period, long_period, signal_period);
 
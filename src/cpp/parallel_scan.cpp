@@ -0,0 +1,75 @@
+#include "parallel_scan.h"
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+// Blocks smaller than this are not worth a thread.
+static const size_t MIN_BLOCK_SIZE = 1 << 16;
+
+void linear_recurrence_scan(const double* x, double scale, double a, double y0, double* out, size_t n, size_t max_blocks) {
+    size_t hw = max_blocks > 0 ? max_blocks : std::max(1u, std::thread::hardware_concurrency());
+    size_t blocks = std::min(hw, std::max<size_t>(1, n / MIN_BLOCK_SIZE));
+    if (blocks == 1) {
+        double y = y0;
+        for (size_t i = 0; i < n; ++i) {
+            y = a * y + scale * x[i];
+            out[i] = y;
+        }
+        return;
+    }
+
+    std::vector<size_t> start(blocks + 1);
+    for (size_t t = 0; t <= blocks; ++t) {
+        start[t] = n * t / blocks;
+    }
+
+    // Pass 1: scan each block from zero; a^len links the block carries
+    std::vector<double> local_carry(blocks), decay(blocks);
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < blocks; ++t) {
+        workers.emplace_back([&, t] {
+            double y = 0.0;
+            for (size_t i = start[t]; i < start[t + 1]; ++i) {
+                y = a * y + scale * x[i];
+                out[i] = y;
+            }
+            local_carry[t] = y;
+            decay[t] = std::pow(a, (double)(start[t + 1] - start[t]));
+        });
+    }
+    for (std::thread& w : workers) w.join();
+    workers.clear();
+
+    // Chain the carries: value entering block t
+    std::vector<double> carry_in(blocks);
+    carry_in[0] = y0;
+    for (size_t t = 1; t < blocks; ++t) {
+        carry_in[t] = local_carry[t - 1] + decay[t - 1] * carry_in[t - 1];
+    }
+
+    // Pass 2: add the decayed incoming carry to every element
+    for (size_t t = 0; t < blocks; ++t) {
+        workers.emplace_back([&, t] {
+            double c = carry_in[t];
+            if (c == 0.0) return;
+            double f = a;
+            for (size_t i = start[t]; i < start[t + 1]; ++i) {
+                double d = f * c;
+                if (std::fabs(d) < std::numeric_limits<double>::min()) break; // Carry has decayed; avoid denormals
+                out[i] += d;
+                f *= a;
+            }
+        });
+    }
+    for (std::thread& w : workers) w.join();
+}
+
+void parallel_ema(const double* x, double* out, size_t n, double alpha, double seed, size_t max_blocks) {
+    linear_recurrence_scan(x, alpha, 1.0 - alpha, seed, out, n, max_blocks);
+}
+
+void parallel_wilder(const double* x, double* out, size_t n, int period, double seed, size_t max_blocks) {
+    linear_recurrence_scan(x, 1.0 / period, (double)(period - 1) / period, seed, out, n, max_blocks);
+}
@@ -0,0 +1,39 @@
+#ifndef PARALLEL_SCAN_H
+#define PARALLEL_SCAN_H
+
+#include <cstddef>
+
+/*
+Multi-threaded scan for first-order linear recurrences y[i] = a * y[i-1] + scale * x[i].
+
+EMA, Wilder RSI smoothing and exponential ATR are all of this form. The series is split into one
+block per core; each block is scanned from zero in parallel, the block carries are chained
+serially, and a second parallel pass adds carry * a^(offset+1) to every element.
+
+Floating-point tolerance: the scan evaluates a * y + scale * x instead of the serial loops'
+(x - y) * k + y and (y * (n - 1) + x) / n, so results are not bit-identical. Since |a| < 1 the
+rounding differences do not accumulate along the series; the error grows roughly with the
+period (about 1e-13 relative at period 5000). For periods up to 10^4 the result agrees with the
+serial loop to within PARALLEL_SCAN_TOLERANCE * max(|y|) at every index. Series shorter than
+PARALLEL_SCAN_THRESHOLD keep the serial loops and their exact results. parallel_scan_test.cpp
+checks the bound.
+*/
+
+// Remaining series length at which calculate_macd, calculate_rsi and calculateATR_exponential
+// switch from the serial loop to the parallel scan.
+const size_t PARALLEL_SCAN_THRESHOLD = 1 << 20;
+
+// Documented agreement with the serial loops, relative to the largest magnitude in the output.
+const double PARALLEL_SCAN_TOLERANCE = 1e-12;
+
+// Computes out[i] = a * out[i-1] + scale * x[i] for i in [0, n) with out[-1] = y0. 'out' may alias 'x'.
+// max_blocks caps the number of blocks (threads); 0 uses one per hardware thread.
+void linear_recurrence_scan(const double* x, double scale, double a, double y0, double* out, size_t n, size_t max_blocks = 0);
+
+// EMA continuation: out[i] = (x[i] - out[i-1]) * alpha + out[i-1], with out[-1] = seed.
+void parallel_ema(const double* x, double* out, size_t n, double alpha, double seed, size_t max_blocks = 0);
+
+// Wilder smoothing continuation: out[i] = (out[i-1] * (period - 1) + x[i]) / period, with out[-1] = seed.
+void parallel_wilder(const double* x, double* out, size_t n, int period, double seed, size_t max_blocks = 0);
+
+#endif // PARALLEL_SCAN_H
@@ -0,0 +1,81 @@
+#include "parallel_scan.h"
+#include <iostream>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <cmath>
+
+/*
+Checks the documented PARALLEL_SCAN_TOLERANCE bound of the parallel scan against the serial
+EMA and Wilder loops of calculate_macd / calculate_rsi / calculateATR_exponential.
+
+Usage (from the repository root):
+    g++ -std=c++17 -O2 -pthread src/cpp/parallel_scan_test.cpp src/cpp/parallel_scan.cpp -o parallel_scan_test
+    ./parallel_scan_test
+
+The block count is forced (2 and 8), so the carry chaining is exercised on any machine.
+Exits with status 1 if any index differs by more than PARALLEL_SCAN_TOLERANCE * max(|y|).
+*/
+
+namespace {
+
+// Relative to the largest magnitude, as documented in parallel_scan.h
+double relative_error(const std::vector<double>& serial, const std::vector<double>& scanned) {
+    double max_abs = 0.0, max_diff = 0.0;
+    for (size_t i = 0; i < serial.size(); ++i) {
+        max_abs = std::max(max_abs, std::fabs(serial[i]));
+        max_diff = std::max(max_diff, std::fabs(serial[i] - scanned[i]));
+    }
+    return max_abs > 0.0 ? max_diff / max_abs : max_diff;
+}
+
+} // namespace
+
+int main() {
+    // Random-walk closes and their absolute changes (the gain/loss/true-range inputs), long enough for 8 blocks
+    const size_t n = PARALLEL_SCAN_THRESHOLD + 12345;
+    std::mt19937_64 rng(42);
+    std::normal_distribution<double> step(0.0, 0.5);
+    std::vector<double> prices(n), changes(n);
+    double price = 100.0;
+    for (size_t i = 0; i < n; ++i) {
+        price = std::max(1.0, price + step(rng));
+        prices[i] = price;
+        changes[i] = std::fabs(step(rng));
+    }
+
+    double worst = 0.0;
+    bool ok = true;
+    for (size_t blocks : {2, 8}) {
+        for (int period : {2, 14, 54, 1000, 10000}) {
+            // EMA over prices, seeded with the first price
+            double alpha = 2.0 / (period + 1);
+            std::vector<double> serial(n), scanned(n);
+            double y = prices[0];
+            for (size_t i = 0; i < n; ++i) {
+                y = (prices[i] - y) * alpha + y;
+                serial[i] = y;
+            }
+            parallel_ema(prices.data(), scanned.data(), n, alpha, prices[0], blocks);
+            double ema_error = relative_error(serial, scanned);
+
+            // Wilder smoothing over absolute changes, seeded with their mean
+            y = 0.5;
+            for (size_t i = 0; i < n; ++i) {
+                y = (y * (period - 1) + changes[i]) / period;
+                serial[i] = y;
+            }
+            parallel_wilder(changes.data(), scanned.data(), n, period, 0.5, blocks);
+            double wilder_error = relative_error(serial, scanned);
+
+            worst = std::max(worst, std::max(ema_error, wilder_error));
+            if (ema_error > PARALLEL_SCAN_TOLERANCE || wilder_error > PARALLEL_SCAN_TOLERANCE) {
+                std::cerr << "FAIL blocks=" << blocks << " period=" << period << ": ema " << ema_error
+                          << ", wilder " << wilder_error << " > " << PARALLEL_SCAN_TOLERANCE << std::endl;
+                ok = false;
+            }
+        }
+    }
+    std::cout << "parallel_scan_test: worst relative error " << worst << " (tolerance " << PARALLEL_SCAN_TOLERANCE << ")" << std::endl;
+    return ok ? 0 : 1;
+}
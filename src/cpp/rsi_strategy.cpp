@@ -1,4 +1,5 @@
 #include "rsi_strategy.h"
+#include "parallel_scan.h"
 #include <iostream>
 #include <fstream>
 #include <sstream>
@@ -44,7 +45,7 @@ std::vector<double> readPricesRSI(const char* csvFile) {
 }
 
 // Calculates RSI values for the given price array using Wilder's smoothing
-void calculate_rsi(const std::vector<double>& prices, std::vector<double>& rsi_values, int period) {
+void calculate_rsi(SeriesView prices, std::vector<double>& rsi_values, int period) {
     if (prices.size() < period + 1) {
         std::cerr << "Not enough data for RSI calculation." << std::endl;
         return;
@@ -64,7 +65,24 @@ void calculate_rsi(const std::vector<double>& prices, std::vector<double>& rsi_v
     double rs = (avg_loss == 0) ? 100 : avg_gain / avg_loss;
     rsi_values.push_back(100 - (100 / (1 + rs)));
     
-    // Subsequent values using Wilder's smoothing
+    // Subsequent values using Wilder's smoothing (parallel scan for very long series)
+    if (prices.size() >= period + 1 + PARALLEL_SCAN_THRESHOLD) {
+        size_t count = prices.size() - period - 1;
+        std::vector<double> gains(count), losses(count);
+        for (size_t j = 0; j < count; ++j) {
+            double change = prices[period + 1 + j] - prices[period + j];
+            gains[j] = (change > 0) ? change : 0.0;
+            losses[j] = (change < 0) ? -change : 0.0;
+        }
+        parallel_wilder(gains.data(), gains.data(), count, period, avg_gain);
+        parallel_wilder(losses.data(), losses.data(), count, period, avg_loss);
+        rsi_values.reserve(count + 1);
+        for (size_t j = 0; j < count; ++j) {
+            rs = (losses[j] == 0) ? 100 : gains[j] / losses[j];
+            rsi_values.push_back(100 - (100 / (1 + rs)));
+        }
+        return;
+    }
     for (size_t i = period + 1; i < prices.size(); ++i) {
         double change = prices[i] - prices[i - 1];
         double current_gain = (change > 0) ? change : 0.0;
@@ -98,7 +116,11 @@ std::vector<int> run_rsi_strategy(const char* csvFile, int period = 14, int over
         std::cerr << "No price data available." << std::endl;
         return {};
     }
-    
+    return generate_rsi_signals(prices, period, overbought, oversold);
+}
+
+// Generates RSI threshold signals from closing prices
+std::vector<int> generate_rsi_signals(SeriesView prices, int period, int overbought, int oversold) {
     std::vector<double> rsi_values;
     calculate_rsi(prices, rsi_values, period);
         
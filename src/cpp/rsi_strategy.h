@@ -2,12 +2,16 @@
 #define RSI_STRATEGY_H
 
 #include <vector>
+#include "data_types.h"
 
 // Runs the RSI strategy on the given CSV file with dynamic parameters.
 std::vector<int> run_rsi_strategy(const char* csvFile, int period, int overbought, int oversold);
 
+// Generates RSI threshold signals from in-memory closing prices.
+std::vector<int> generate_rsi_signals(SeriesView prices, int period, int overbought, int oversold);
+
 // Calculates the RSI values for a given price array.
-void calculate_rsi(const std::vector<double>& prices, std::vector<double>& rsi_values, int period);
+void calculate_rsi(SeriesView prices, std::vector<double>& rsi_values, int period);
 
 // Evaluates the RSI strategy and calculates performance metrics.
 void evaluate_rsi_strategy(const std::vector<double>& prices, const std::vector<double>& rsi_values);
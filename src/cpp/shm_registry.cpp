@@ -0,0 +1,358 @@
+#include "shm_registry.h"
+
+#ifdef __linux__
+
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <atomic>
+#include <cstring>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+namespace {
+
+const char* const INDEX_SEGMENT = "/trisignal.index";
+const uint32_t INDEX_MAGIC = 0x32445354;  // "TSD2"
+const uint32_t SERIES_MAGIC = 0x53455354; // "TSES"
+const size_t NUM_COLUMNS = 5;             // open, high, low, close, volume
+
+struct IndexHeader {
+    uint32_t magic;
+    uint32_t capacity;
+    uint64_t next_generation;
+};
+
+// Segment names are "/trisignal.<name>@<pid>.<counter>" ('@' cannot occur in a series name), so
+// they fit in twice the series name
+const size_t MAX_SEGMENT_NAME = 2 * (MAX_SHM_SERIES_NAME + 1);
+
+// An empty name marks a free slot
+struct IndexEntry {
+    char name[MAX_SHM_SERIES_NAME + 1];
+    char segment[MAX_SEGMENT_NAME];
+    uint64_t rows;
+    uint64_t generation;
+};
+
+struct SeriesHeader {
+    uint32_t magic;
+    uint32_t columns;
+    uint64_t rows;
+};
+
+const size_t INDEX_SIZE = sizeof(IndexHeader) + MAX_SHM_SERIES * sizeof(IndexEntry);
+
+bool valid_name(const char* name) {
+    size_t len = std::strlen(name);
+    if (len == 0 || len > MAX_SHM_SERIES_NAME) return false;
+    for (size_t i = 0; i < len; ++i) {
+        char c = name[i];
+        bool ok = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '.' || c == '_' || c == '-';
+        if (!ok) return false;
+    }
+    return true;
+}
+
+// Unique per publish call, so the block can be written before the index is locked
+std::string new_segment_name(const char* name) {
+    static std::atomic<uint64_t> counter(0);
+    return std::string("/trisignal.") + name + "@" + std::to_string(::getpid()) + "." + std::to_string(counter++);
+}
+
+// Creates a segment holding the header and the columns back to back.
+bool write_segment(const std::string& segment, const std::vector<double> (&columns)[NUM_COLUMNS]) {
+    size_t rows = columns[0].size();
+    size_t size = sizeof(SeriesHeader) + NUM_COLUMNS * rows * sizeof(double);
+    int fd = ::shm_open(segment.c_str(), O_RDWR | O_CREAT | O_EXCL, 0644);
+    if (fd < 0) return false;
+    if (::ftruncate(fd, size) != 0) {
+        ::close(fd);
+        ::shm_unlink(segment.c_str());
+        return false;
+    }
+    void* m = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (m == MAP_FAILED) {
+        ::shm_unlink(segment.c_str());
+        return false;
+    }
+    SeriesHeader header = {SERIES_MAGIC, (uint32_t)NUM_COLUMNS, (uint64_t)rows};
+    std::memcpy(m, &header, sizeof(header));
+    double* data = reinterpret_cast<double*>(static_cast<char*>(m) + sizeof(SeriesHeader));
+    for (size_t c = 0; c < NUM_COLUMNS; ++c) {
+        std::memcpy(data + c * rows, columns[c].data(), rows * sizeof(double));
+    }
+    ::munmap(m, size);
+    return true;
+}
+
+// Maps the index segment and holds flock() on it for the handle's lifetime:
+// exclusive for writers (creating the index if needed), shared for readers.
+class IndexHandle {
+public:
+    explicit IndexHandle(bool writable) {
+        fd = ::shm_open(INDEX_SEGMENT, writable ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+        if (fd < 0) return;
+        if (::flock(fd, writable ? LOCK_EX : LOCK_SH) != 0) return;
+        locked = true;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0) return;
+        bool fresh = st.st_size == 0;
+        if (fresh) {
+            if (!writable || ::ftruncate(fd, INDEX_SIZE) != 0) return;
+        } else if ((size_t)st.st_size != INDEX_SIZE) {
+            return;
+        }
+        void* m = ::mmap(nullptr, INDEX_SIZE, writable ? (PROT_READ | PROT_WRITE) : PROT_READ, MAP_SHARED, fd, 0);
+        if (m == MAP_FAILED) return;
+        map = m;
+        header = static_cast<IndexHeader*>(map);
+        entries = reinterpret_cast<IndexEntry*>(static_cast<char*>(map) + sizeof(IndexHeader));
+        if (fresh) {
+            header->magic = INDEX_MAGIC;
+            header->capacity = MAX_SHM_SERIES;
+            header->next_generation = 1;
+        } else if (header->magic != INDEX_MAGIC || header->capacity != MAX_SHM_SERIES) {
+            ::munmap(map, INDEX_SIZE);
+            map = nullptr;
+        }
+    }
+
+    ~IndexHandle() {
+        if (map) ::munmap(map, INDEX_SIZE);
+        if (locked) ::flock(fd, LOCK_UN);
+        if (fd >= 0) ::close(fd);
+    }
+
+    bool ok() const { return map != nullptr; }
+
+    IndexEntry* find(const char* name) const {
+        for (size_t i = 0; i < MAX_SHM_SERIES; ++i) {
+            if (std::strncmp(entries[i].name, name, sizeof(entries[i].name)) == 0) return &entries[i];
+        }
+        return nullptr;
+    }
+
+    IndexEntry* find_free() const {
+        for (size_t i = 0; i < MAX_SHM_SERIES; ++i) {
+            if (entries[i].name[0] == '\0') return &entries[i];
+        }
+        return nullptr;
+    }
+
+    IndexHeader* header = nullptr;
+    IndexEntry* entries = nullptr;
+
+private:
+    int fd = -1;
+    bool locked = false;
+    void* map = nullptr;
+};
+
+// Reads Open/High/Low/Close/Volume columns; CSV columns are Date, Close, High, Low, Open, Volume.
+bool readOHLCV(const char* csvFile, std::vector<double> (&columns)[NUM_COLUMNS]) {
+    std::ifstream file(csvFile);
+    if (!file.is_open()) {
+        std::cerr << "Error opening file: " << csvFile << std::endl;
+        return false;
+    }
+    std::string line;
+    std::getline(file, line); // Skip header
+    while (std::getline(file, line)) {
+        std::stringstream ss(line);
+        std::string token;
+        int col = 0;
+        double values[NUM_COLUMNS] = {0.0, 0.0, 0.0, 0.0, 0.0};
+        while (std::getline(ss, token, ',')) {
+            col++;
+            if (col == 2) values[3] = std::stod(token); // Close
+            if (col == 3) values[1] = std::stod(token); // High
+            if (col == 4) values[2] = std::stod(token); // Low
+            if (col == 5) values[0] = std::stod(token); // Open
+            if (col == 6) values[4] = std::stod(token); // Volume
+        }
+        for (size_t c = 0; c < NUM_COLUMNS; ++c) {
+            columns[c].push_back(values[c]);
+        }
+    }
+    return true;
+}
+
+// Looks up the generation currently published under 'name'; 0 if none.
+uint64_t current_generation(const char* name) {
+    IndexHandle index(false);
+    if (!index.ok()) return 0;
+    IndexEntry* entry = index.find(name);
+    return entry ? entry->generation : 0;
+}
+
+} // namespace
+
+SharedSeries::~SharedSeries() {
+    detach();
+}
+
+SharedSeries::SharedSeries(SharedSeries&& other) noexcept {
+    *this = std::move(other);
+}
+
+SharedSeries& SharedSeries::operator=(SharedSeries&& other) noexcept {
+    if (this != &other) {
+        detach();
+        map = other.map;
+        map_size = other.map_size;
+        num_rows = other.num_rows;
+        gen = other.gen;
+        other.map = nullptr;
+        other.map_size = other.num_rows = 0;
+        other.gen = 0;
+    }
+    return *this;
+}
+
+bool SharedSeries::attach(const char* name) {
+    detach();
+    if (!valid_name(name)) return false;
+
+    // Hold the shared index lock until the segment is mapped, so it cannot be unlinked in between
+    IndexHandle index(false);
+    if (!index.ok()) return false;
+    IndexEntry* entry = index.find(name);
+    if (!entry) return false;
+
+    int fd = ::shm_open(entry->segment, O_RDONLY, 0);
+    if (fd < 0) return false;
+    struct stat st;
+    size_t expected = sizeof(SeriesHeader) + NUM_COLUMNS * entry->rows * sizeof(double);
+    if (::fstat(fd, &st) != 0 || (size_t)st.st_size != expected) {
+        ::close(fd);
+        return false;
+    }
+    void* m = ::mmap(nullptr, expected, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (m == MAP_FAILED) return false;
+
+    const SeriesHeader* header = static_cast<const SeriesHeader*>(m);
+    if (header->magic != SERIES_MAGIC || header->columns != NUM_COLUMNS || header->rows != entry->rows) {
+        ::munmap(m, expected);
+        return false;
+    }
+    map = m;
+    map_size = expected;
+    num_rows = (size_t)header->rows;
+    gen = entry->generation;
+    return true;
+}
+
+void SharedSeries::detach() {
+    if (map) ::munmap(map, map_size);
+    map = nullptr;
+    map_size = num_rows = 0;
+    gen = 0;
+}
+
+SeriesView SharedSeries::column(size_t c) const {
+    if (!map) return SeriesView();
+    const double* data = reinterpret_cast<const double*>(static_cast<const char*>(map) + sizeof(SeriesHeader));
+    return SeriesView(data + c * num_rows, num_rows);
+}
+
+bool shm_publish_series(const char* name, const char* csvFile) {
+    if (!valid_name(name)) {
+        std::cerr << "Invalid series name: " << name << std::endl;
+        return false;
+    }
+    std::vector<double> columns[NUM_COLUMNS];
+    if (!readOHLCV(csvFile, columns)) return false;
+
+    // Write the block outside the index lock; the exclusive lock only covers the entry swap
+    std::string segment = new_segment_name(name);
+    if (!write_segment(segment, columns)) {
+        std::cerr << "Error creating shared-memory segment: " << segment << std::endl;
+        return false;
+    }
+
+    std::string old_segment;
+    {
+        IndexHandle index(true);
+        IndexEntry* entry = index.ok() ? index.find(name) : nullptr;
+        if (!index.ok()) {
+            std::cerr << "Error opening shared-memory index." << std::endl;
+        } else if (entry) {
+            old_segment = entry->segment;
+        } else if (!(entry = index.find_free())) {
+            std::cerr << "Shared-memory index is full." << std::endl;
+        }
+        if (!entry) {
+            ::shm_unlink(segment.c_str());
+            return false;
+        }
+        std::strncpy(entry->name, name, sizeof(entry->name) - 1);
+        entry->name[sizeof(entry->name) - 1] = '\0';
+        std::strncpy(entry->segment, segment.c_str(), sizeof(entry->segment) - 1);
+        entry->segment[sizeof(entry->segment) - 1] = '\0';
+        entry->rows = columns[0].size();
+        entry->generation = index.header->next_generation++;
+    }
+
+    if (!old_segment.empty()) {
+        ::shm_unlink(old_segment.c_str());
+    }
+    return true;
+}
+
+bool shm_unpublish_series(const char* name) {
+    if (!valid_name(name)) return false;
+    std::string segment;
+    {
+        IndexHandle index(true);
+        if (!index.ok()) return false;
+        IndexEntry* entry = index.find(name);
+        if (!entry) return false;
+        segment = entry->segment;
+        std::memset(entry, 0, sizeof(IndexEntry));
+    }
+    ::shm_unlink(segment.c_str());
+    return true;
+}
+
+std::vector<std::string> shm_list_series() {
+    std::vector<std::string> names;
+    IndexHandle index(false);
+    if (!index.ok()) return names;
+    for (size_t i = 0; i < MAX_SHM_SERIES; ++i) {
+        if (index.entries[i].name[0] != '\0') names.push_back(index.entries[i].name);
+    }
+    return names;
+}
+
+std::shared_ptr<const SharedSeries> shm_attach_series(const char* name) {
+    static std::mutex cache_mutex;
+    static std::map<std::string, std::shared_ptr<const SharedSeries>> cache;
+
+    uint64_t generation = current_generation(name);
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto it = cache.find(name);
+    if (generation == 0) {
+        if (it != cache.end()) cache.erase(it);
+        return nullptr;
+    }
+    if (it != cache.end() && it->second->generation() == generation) {
+        return it->second;
+    }
+    std::shared_ptr<SharedSeries> series = std::make_shared<SharedSeries>();
+    if (!series->attach(name)) return nullptr;
+    cache[name] = series;
+    return series;
+}
+
+#endif // __linux__
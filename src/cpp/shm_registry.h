@@ -0,0 +1,80 @@
+#ifndef SHM_REGISTRY_H
+#define SHM_REGISTRY_H
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include "data_types.h"
+
+/*
+Shared-memory price registry (POSIX shm, Linux only). shm_registry.cpp compiles to nothing on other
+platforms and bindings.cpp only exposes it on Linux: the segment names can exceed the 31 characters
+macOS allows, and attach() expects shm objects to report their exact st_size.
+
+A loader process parses each CSV once and publishes it as a columnar OHLCV block in its own
+shared-memory segment, recorded under a series name in a fixed-size index segment. Worker
+processes look the name up and map the block read-only, so N workers share one copy of the
+data and never parse. The index is guarded by flock() on the index segment.
+
+Republishing a name writes a new segment and switches the index entry to it; processes that
+already mapped the old block keep a valid mapping until they detach. The block is written under
+a unique segment name before the index is locked, so the exclusive lock only covers the entry
+swap and lookups by other workers are never held up by a large copy. A publisher that dies
+between the two steps leaves an orphaned /trisignal.<name>@<pid>.* segment behind.
+*/
+
+// Maximum length of a series name (letters, digits, '.', '_' and '-').
+const size_t MAX_SHM_SERIES_NAME = 63;
+
+// Maximum number of series in the index.
+const size_t MAX_SHM_SERIES = 1024;
+
+// Read-only mapping of one published series. Move-only; unmaps on destruction.
+class SharedSeries {
+public:
+    SharedSeries() {}
+    ~SharedSeries();
+    SharedSeries(SharedSeries&& other) noexcept;
+    SharedSeries& operator=(SharedSeries&& other) noexcept;
+    SharedSeries(const SharedSeries&) = delete;
+    SharedSeries& operator=(const SharedSeries&) = delete;
+
+    // Maps the series currently published under 'name'. Returns false if it is not published.
+    bool attach(const char* name);
+    void detach();
+
+    bool attached() const { return map != nullptr; }
+    size_t rows() const { return num_rows; }
+    uint64_t generation() const { return gen; }
+
+    SeriesView open() const { return column(0); }
+    SeriesView high() const { return column(1); }
+    SeriesView low() const { return column(2); }
+    SeriesView close() const { return column(3); }
+    SeriesView volume() const { return column(4); }
+    PriceSeriesView prices() const { return PriceSeriesView(high(), low(), close()); }
+
+private:
+    SeriesView column(size_t c) const;
+
+    void* map = nullptr;
+    size_t map_size = 0;
+    size_t num_rows = 0;
+    uint64_t gen = 0;
+};
+
+// Parses a CSV (Date, Close, High, Low, Open, Volume) and publishes it under 'name'.
+bool shm_publish_series(const char* name, const char* csvFile);
+
+// Removes 'name' from the index and unlinks its segment.
+bool shm_unpublish_series(const char* name);
+
+// Names currently published.
+std::vector<std::string> shm_list_series();
+
+// Process-wide attachment cache: maps each name once and re-maps only after it is republished.
+std::shared_ptr<const SharedSeries> shm_attach_series(const char* name);
+
+#endif // SHM_REGISTRY_H
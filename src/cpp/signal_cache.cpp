@@ -0,0 +1,357 @@
+#include "signal_cache.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <algorithm>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <ctime>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*
+On-disk layout:
+- One file per entry, <directory>/<16 hex digit key>.bin, holding an EntryHeader followed by
+  the raw int32 or float64 values.
+- Writers build the entry in a per-process temp file and rename() it into place, so readers in
+  other processes only ever see complete entries.
+- A hit refreshes the entry's mtime; eviction removes the oldest-mtime entries first and is
+  serialised across processes with flock() on <directory>/.lock.
+- Readers map the entry read-only; an entry evicted while mapped stays valid until unmapped.
+- Temp files count toward max_bytes. Eviction deletes any older than STALE_TEMP_SECONDS, since
+  those were left by a writer that crashed before its rename().
+*/
+
+namespace {
+
+const uint64_t FNV_OFFSET = 1469598103934665603ULL;
+const uint64_t FNV_PRIME = 1099511628211ULL;
+
+} // namespace
+
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed) {
+    const unsigned char* p = static_cast<const unsigned char*>(data);
+    uint64_t h = seed;
+    for (size_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= FNV_PRIME;
+    }
+    return h;
+}
+
+static uint64_t hash_params(uint64_t h, const char* id, const std::vector<double>& params) {
+    h = hash_bytes(&SIGNAL_CACHE_VERSION, sizeof(SIGNAL_CACHE_VERSION), h);
+    h = hash_bytes(id, std::strlen(id) + 1, h);
+    return hash_bytes(params.data(), params.size() * sizeof(double), h);
+}
+
+uint64_t indicator_cache_key(const std::vector<const std::vector<double>*>& series, const char* indicator_id, const std::vector<double>& params) {
+    uint64_t h = FNV_OFFSET;
+    for (const std::vector<double>* s : series) {
+        uint64_t n = s->size();
+        h = hash_bytes(&n, sizeof(n), h);
+        h = hash_bytes(s->data(), s->size() * sizeof(double), h);
+    }
+    return hash_params(h, indicator_id, params);
+}
+
+std::vector<int> cached_strategy_signals(const char* csvFile, const char* strategy_id, const std::vector<double>& params, const std::function<std::vector<int>()>& compute) {
+    uint64_t key;
+    if (!signal_cache_enabled() || !strategy_cache_key(csvFile, strategy_id, params, key)) {
+        return compute();
+    }
+    std::vector<int> signals;
+    if (signal_cache_load(key, signals)) {
+        return signals;
+    }
+    signals = compute();
+    if (!signals.empty()) { // Don't cache failed runs
+        signal_cache_store(key, signals);
+    }
+    return signals;
+}
+
+#ifndef _WIN32
+
+namespace {
+
+const uint32_t CACHE_MAGIC = 0x31435354; // "TSC1"
+const uint32_t ENTRY_INT32 = 1;
+const uint32_t ENTRY_FLOAT64 = 2;
+
+// A temp file untouched for this long belongs to a writer that died mid-store.
+const time_t STALE_TEMP_SECONDS = 300;
+
+struct EntryHeader {
+    uint32_t magic;
+    uint32_t type;
+    uint64_t key;
+    uint64_t count;
+};
+
+std::mutex cache_mutex;
+std::string cache_dir;
+size_t cache_max_bytes = DEFAULT_SIGNAL_CACHE_BYTES;
+bool cache_on = false;
+
+// Snapshot of the cache settings; returns false when the cache is disabled.
+bool cache_settings(std::string& dir, size_t& max_bytes) {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    dir = cache_dir;
+    max_bytes = cache_max_bytes;
+    return cache_on;
+}
+
+std::string entry_path(const std::string& dir, uint64_t key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", (unsigned long long)key);
+    return dir + "/" + name;
+}
+
+bool write_all(int fd, const void* data, size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, p, size);
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return false;
+        }
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+bool load_entry(uint64_t key, uint32_t type, size_t elem_size, void* (*resize)(void*, size_t), void* out) {
+    std::string dir;
+    size_t max_bytes;
+    if (!cache_settings(dir, max_bytes)) return false;
+
+    int fd = ::open(entry_path(dir, key).c_str(), O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(EntryHeader)) {
+        ::close(fd);
+        return false;
+    }
+    size_t size = (size_t)st.st_size;
+    void* map = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (map == MAP_FAILED) {
+        ::close(fd);
+        return false;
+    }
+
+    EntryHeader header;
+    std::memcpy(&header, map, sizeof(header));
+    bool ok = header.magic == CACHE_MAGIC && header.type == type && header.key == key &&
+              size == sizeof(EntryHeader) + header.count * elem_size;
+    if (ok) {
+        void* dest = resize(out, (size_t)header.count);
+        if (header.count > 0) {
+            std::memcpy(dest, static_cast<const char*>(map) + sizeof(EntryHeader), header.count * elem_size);
+        }
+        ::futimens(fd, nullptr); // Mark as recently used
+    }
+    ::munmap(map, size);
+    ::close(fd);
+    return ok;
+}
+
+// Removes stale temp files, then least-recently-used entries until the directory fits in max_bytes.
+void evict(const std::string& dir, size_t max_bytes) {
+    std::string lock_path = dir + "/.lock";
+    int lock_fd = ::open(lock_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (lock_fd < 0) return;
+    if (::flock(lock_fd, LOCK_EX) != 0) {
+        ::close(lock_fd);
+        return;
+    }
+
+    struct Entry {
+        std::string path;
+        size_t size;
+        struct timespec mtime;
+    };
+    std::vector<Entry> entries;
+    size_t total = 0;
+    time_t now = ::time(nullptr);
+    if (DIR* d = ::opendir(dir.c_str())) {
+        while (struct dirent* e = ::readdir(d)) {
+            // <key>.bin entries and <key>.bin.tmp.<pid>.<n> temp files
+            std::string name = e->d_name;
+            bool is_entry = name.size() == 20 && name.compare(16, 4, ".bin") == 0;
+            bool is_temp = name.size() > 25 && name.compare(16, 9, ".bin.tmp.") == 0;
+            if (!is_entry && !is_temp) continue;
+            std::string path = dir + "/" + name;
+            struct stat st;
+            if (::stat(path.c_str(), &st) != 0) continue;
+            if (is_temp) {
+                // A live writer's temp file is counted but left alone; it becomes an entry shortly
+                if (now - st.st_mtim.tv_sec > STALE_TEMP_SECONDS && ::unlink(path.c_str()) == 0) continue;
+                total += (size_t)st.st_size;
+                continue;
+            }
+            entries.push_back({path, (size_t)st.st_size, st.st_mtim});
+            total += (size_t)st.st_size;
+        }
+        ::closedir(d);
+    }
+
+    if (total > max_bytes) {
+        std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+            if (a.mtime.tv_sec != b.mtime.tv_sec) return a.mtime.tv_sec < b.mtime.tv_sec;
+            return a.mtime.tv_nsec < b.mtime.tv_nsec;
+        });
+        for (const Entry& e : entries) {
+            if (total <= max_bytes) break;
+            if (::unlink(e.path.c_str()) == 0) total -= e.size;
+        }
+    }
+
+    ::flock(lock_fd, LOCK_UN);
+    ::close(lock_fd);
+}
+
+void store_entry(uint64_t key, uint32_t type, const void* data, size_t count, size_t elem_size) {
+    std::string dir;
+    size_t max_bytes;
+    if (!cache_settings(dir, max_bytes)) return;
+
+    std::string path = entry_path(dir, key);
+    char suffix[48];
+    static std::mutex temp_mutex;
+    static unsigned long temp_counter = 0;
+    {
+        std::lock_guard<std::mutex> lock(temp_mutex);
+        std::snprintf(suffix, sizeof(suffix), ".tmp.%ld.%lu", (long)::getpid(), temp_counter++);
+    }
+    std::string temp_path = path + suffix;
+
+    int fd = ::open(temp_path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "Error writing signal cache entry: " << temp_path << std::endl;
+        return;
+    }
+    EntryHeader header = {CACHE_MAGIC, type, key, (uint64_t)count};
+    bool ok = write_all(fd, &header, sizeof(header)) && write_all(fd, data, count * elem_size);
+    ok = (::close(fd) == 0) && ok;
+    if (!ok || ::rename(temp_path.c_str(), path.c_str()) != 0) {
+        std::cerr << "Error writing signal cache entry: " << path << std::endl;
+        ::unlink(temp_path.c_str());
+        return;
+    }
+    evict(dir, max_bytes);
+}
+
+template <typename T>
+void* resize_vector(void* v, size_t count) {
+    std::vector<T>& vec = *static_cast<std::vector<T>*>(v);
+    vec.resize(count);
+    return vec.data();
+}
+
+} // namespace
+
+bool enable_signal_cache(const char* directory, size_t max_bytes) {
+    if (::mkdir(directory, 0755) != 0 && errno != EEXIST) {
+        std::cerr << "Error creating signal cache directory: " << directory << std::endl;
+        return false;
+    }
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_dir = directory;
+    cache_max_bytes = max_bytes;
+    cache_on = true;
+    return true;
+}
+
+void disable_signal_cache() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    cache_on = false;
+}
+
+bool signal_cache_enabled() {
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    return cache_on;
+}
+
+bool strategy_cache_key(const char* csvFile, const char* strategy_id, const std::vector<double>& params, uint64_t& key) {
+    int fd = ::open(csvFile, O_RDONLY);
+    if (fd < 0) return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0) {
+        ::close(fd);
+        return false;
+    }
+    uint64_t h = FNV_OFFSET;
+    size_t size = (size_t)st.st_size;
+    if (size > 0) {
+        void* map = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map == MAP_FAILED) {
+            ::close(fd);
+            return false;
+        }
+        h = hash_bytes(map, size, h);
+        ::munmap(map, size);
+    }
+    ::close(fd);
+    key = hash_params(h, strategy_id, params);
+    return true;
+}
+
+bool signal_cache_load(uint64_t key, std::vector<int>& values) {
+    static_assert(sizeof(int) == 4, "signal cache stores int32 signals");
+    return load_entry(key, ENTRY_INT32, sizeof(int), &resize_vector<int>, &values);
+}
+
+bool signal_cache_load(uint64_t key, std::vector<double>& values) {
+    return load_entry(key, ENTRY_FLOAT64, sizeof(double), &resize_vector<double>, &values);
+}
+
+void signal_cache_store(uint64_t key, const std::vector<int>& values) {
+    store_entry(key, ENTRY_INT32, values.data(), values.size(), sizeof(int));
+}
+
+void signal_cache_store(uint64_t key, const std::vector<double>& values) {
+    store_entry(key, ENTRY_FLOAT64, values.data(), values.size(), sizeof(double));
+}
+
+#else // _WIN32
+
+// The cache relies on mmap, flock and futimens. On Windows it stays disabled and every strategy
+// call computes its signals directly.
+bool enable_signal_cache(const char* directory, size_t) {
+    std::cerr << "The persistent signal cache is not supported on Windows; not using " << directory << std::endl;
+    return false;
+}
+
+void disable_signal_cache() {}
+
+bool signal_cache_enabled() {
+    return false;
+}
+
+bool strategy_cache_key(const char*, const char*, const std::vector<double>&, uint64_t&) {
+    return false;
+}
+
+bool signal_cache_load(uint64_t, std::vector<int>&) {
+    return false;
+}
+
+bool signal_cache_load(uint64_t, std::vector<double>&) {
+    return false;
+}
+
+void signal_cache_store(uint64_t, const std::vector<int>&) {}
+
+void signal_cache_store(uint64_t, const std::vector<double>&) {}
+
+#endif // _WIN32
@@ -0,0 +1,50 @@
+#ifndef SIGNAL_CACHE_H
+#define SIGNAL_CACHE_H
+
+#include <vector>
+#include <string>
+#include <functional>
+#include <cstdint>
+#include <cstddef>
+
+// Mixed into every cache key. Bump it whenever a change to the strategy or indicator code (or to
+// parallel_scan) can change their output, so persistent caches stop serving the old results.
+const uint32_t SIGNAL_CACHE_VERSION = 1;
+
+// Default on-disk budget for the signal cache (256 MiB).
+const size_t DEFAULT_SIGNAL_CACHE_BYTES = 256u * 1024u * 1024u;
+
+// Enables the persistent signal cache in the given directory (created if missing).
+// Entries are evicted least-recently-used first once the directory exceeds max_bytes.
+// The cache is off until this is called.
+// POSIX only: on Windows (MinGW) this returns false and strategies always compute directly.
+bool enable_signal_cache(const char* directory, size_t max_bytes);
+
+// Disables the cache; existing entries are left on disk.
+void disable_signal_cache();
+
+bool signal_cache_enabled();
+
+// FNV-1a hash of a byte range, chained through 'seed'.
+uint64_t hash_bytes(const void* data, size_t size, uint64_t seed);
+
+// Cache key for a strategy run: content hash of the CSV file, strategy id, parameters and SIGNAL_CACHE_VERSION.
+// Returns false if the file cannot be read.
+bool strategy_cache_key(const char* csvFile, const char* strategy_id, const std::vector<double>& params, uint64_t& key);
+
+// Cache key for an indicator computed from in-memory series (also versioned).
+uint64_t indicator_cache_key(const std::vector<const std::vector<double>*>& series, const char* indicator_id, const std::vector<double>& params);
+
+// Reads an entry through a memory mapping. Returns false on a miss or a corrupt entry.
+bool signal_cache_load(uint64_t key, std::vector<int>& values);
+bool signal_cache_load(uint64_t key, std::vector<double>& values);
+
+// Writes an entry atomically (temp file + rename) and runs LRU eviction.
+void signal_cache_store(uint64_t key, const std::vector<int>& values);
+void signal_cache_store(uint64_t key, const std::vector<double>& values);
+
+// Returns the strategy signals from the cache when enabled, otherwise (or on a miss) calls compute()
+// and stores the result.
+std::vector<int> cached_strategy_signals(const char* csvFile, const char* strategy_id, const std::vector<double>& params, const std::function<std::vector<int>()>& compute);
+
+#endif // SIGNAL_CACHE_H
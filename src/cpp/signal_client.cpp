@@ -0,0 +1,133 @@
+#include "signal_protocol.h"
+#include "strategy_dispatch.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <algorithm>
+#include <cstring>
+#include <cstdlib>
+#include <cstdio>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*
+Load generator for signal_server.
+
+Usage:
+    signal_client --socket /tmp/trisignal.sock --symbol AAPL [--strategy NAME | --predict]
+                  [--threads 8] [--requests 1000]
+
+Each thread opens its own connection and sends requests back to back. Per-request latency
+(send to full response) is collected across threads and reported as p50 / p99 / max.
+*/
+
+namespace {
+
+int connect_to(const std::string& socket_path) {
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) return -1;
+    std::strcpy(addr.sun_path, socket_path.c_str());
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) return -1;
+    if (::connect(fd, (sockaddr*)&addr, sizeof(addr)) != 0) {
+        ::close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+double percentile(const std::vector<double>& sorted, double q) {
+    if (sorted.empty()) return 0.0;
+    size_t index = std::min(sorted.size() - 1, (size_t)(q * (sorted.size() - 1) + 0.5));
+    return sorted[index];
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string socket_path, symbol;
+    RequestHeader header = {SIGNAL_PROTOCOL_MAGIC, REQUEST_PREDICT, 0, 0, 0};
+    int num_threads = 8;
+    int num_requests = 1000;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (arg == "--symbol" && i + 1 < argc) {
+            symbol = argv[++i];
+        } else if (arg == "--strategy" && i + 1 < argc) {
+            StrategyId id;
+            if (!strategy_from_name(argv[++i], id)) {
+                std::cerr << "Unknown strategy: " << argv[i] << std::endl;
+                return 1;
+            }
+            header.kind = REQUEST_SIGNALS;
+            header.strategy = id;
+        } else if (arg == "--predict") {
+            header.kind = REQUEST_PREDICT;
+        } else if (arg == "--threads" && i + 1 < argc) {
+            num_threads = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--requests" && i + 1 < argc) {
+            num_requests = std::max(1, std::atoi(argv[++i]));
+        } else {
+            std::cerr << "Usage: " << argv[0] << " --socket PATH --symbol NAME [--strategy NAME | --predict] [--threads N] [--requests N]" << std::endl;
+            return 1;
+        }
+    }
+    if (socket_path.empty() || symbol.empty() || symbol.size() > MAX_SYMBOL_LENGTH) {
+        std::cerr << "Usage: " << argv[0] << " --socket PATH --symbol NAME [--strategy NAME | --predict] [--threads N] [--requests N]" << std::endl;
+        return 1;
+    }
+    header.symbol_len = (uint16_t)symbol.size();
+
+    std::vector<std::vector<double>> latencies(num_threads);
+    std::vector<int> failures(num_threads, 0);
+    std::vector<std::thread> threads;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (int t = 0; t < num_threads; ++t) {
+        threads.emplace_back([&, t] {
+            int fd = connect_to(socket_path);
+            if (fd < 0) {
+                failures[t] = num_requests;
+                return;
+            }
+            std::vector<int32_t> values;
+            for (int r = 0; r < num_requests; ++r) {
+                std::chrono::steady_clock::time_point sent = std::chrono::steady_clock::now();
+                ResponseHeader response;
+                if (!write_full(fd, &header, sizeof(header)) || !write_full(fd, symbol.data(), symbol.size()) ||
+                    !read_full(fd, &response, sizeof(response)) || response.magic != SIGNAL_PROTOCOL_MAGIC) {
+                    failures[t] += num_requests - r;
+                    break;
+                }
+                values.resize(response.count);
+                if (!read_full(fd, values.data(), values.size() * sizeof(int32_t))) {
+                    failures[t] += num_requests - r;
+                    break;
+                }
+                if (response.status != STATUS_OK) failures[t]++;
+                latencies[t].push_back(std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - sent).count());
+            }
+            ::close(fd);
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::vector<double> all;
+    int failed = 0;
+    for (int t = 0; t < num_threads; ++t) {
+        all.insert(all.end(), latencies[t].begin(), latencies[t].end());
+        failed += failures[t];
+    }
+    std::sort(all.begin(), all.end());
+    std::printf("requests: %zu  failed: %d  threads: %d  throughput: %.0f req/s\n", all.size(), failed, num_threads, all.size() / elapsed);
+    std::printf("latency (us): p50 %.1f  p99 %.1f  max %.1f\n", percentile(all, 0.50), percentile(all, 0.99), all.empty() ? 0.0 : all.back());
+    return failed == 0 ? 0 : 1;
+}
@@ -0,0 +1,161 @@
+#include "signal_pipeline.h"
+#include "spsc_queue.h"
+#include "supertrend_strategy.h"
+#include "strategy_dispatch.h"
+#include <iostream>
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include <algorithm>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// State of one symbol as it moves through the stages.
+struct SymbolWork {
+    size_t index;
+    PriceSeries series;
+    std::vector<std::vector<int>> signals;
+    std::vector<double> features;
+    size_t rows = 0;
+};
+
+using BatchPtr = std::unique_ptr<std::vector<SymbolWork>>;
+using BatchQueue = SpscQueue<BatchPtr>;
+
+double seconds_since(Clock::time_point start) {
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+// Pushes a batch, parking while the downstream queue is full.
+void push_blocking(BatchQueue& queue, BatchPtr& batch, StageMetrics& metrics) {
+    if (queue.try_push(batch)) return;
+    Clock::time_point start = Clock::now();
+    queue.push(batch);
+    metrics.output_wait_seconds += seconds_since(start);
+}
+
+// Pops a batch, parking while the upstream queue is empty. Returns false at end of stream.
+bool pop_blocking(BatchQueue& queue, BatchPtr& batch, StageMetrics& metrics) {
+    if (queue.try_pop(batch)) return true;
+    Clock::time_point start = Clock::now();
+    bool popped = queue.pop(batch);
+    metrics.input_wait_seconds += seconds_since(start);
+    return popped;
+}
+
+// Runs 'work' on every batch from 'in' and forwards it to 'out' (if any), then closes 'out'.
+// A symbol whose work throws is reported and passed on with no signals or features, so it ends up
+// with an empty prediction instead of taking the thread (and the process) down.
+template <typename Work>
+void run_stage(BatchQueue& in, BatchQueue* out, StageMetrics& metrics, const std::vector<std::string>& csvFiles, Work work) {
+    BatchPtr batch;
+    while (pop_blocking(in, batch, metrics)) {
+        Clock::time_point start = Clock::now();
+        for (SymbolWork& symbol : *batch) {
+            try {
+                work(symbol);
+            } catch (const std::exception& e) {
+                std::cerr << "Error in " << metrics.name << " stage: " << csvFiles[symbol.index] << " (" << e.what() << ")" << std::endl;
+                symbol.signals.clear();
+                symbol.features.clear();
+                symbol.rows = 0;
+            }
+        }
+        metrics.busy_seconds += seconds_since(start);
+        metrics.batches++;
+        metrics.symbols += batch->size();
+        if (out) push_blocking(*out, batch, metrics);
+        batch.reset();
+    }
+    if (out) out->close();
+}
+
+} // namespace
+
+PipelineResult run_signal_pipeline(const std::vector<std::string>& csvFiles, const FusionModel& model, const FusionParams& params, size_t batch_size, size_t queue_capacity) {
+    PipelineResult result;
+    if (model.input_dim() != NUM_FUSION_FEATURES) {
+        std::cerr << "Fusion model expects " << model.input_dim() << " inputs, pipeline produces " << NUM_FUSION_FEATURES << "." << std::endl;
+        return result;
+    }
+    batch_size = std::max<size_t>(1, batch_size);
+    queue_capacity = std::max<size_t>(1, queue_capacity);
+
+    result.symbols = csvFiles;
+    result.predictions.resize(csvFiles.size());
+    result.stages.resize(4);
+    StageMetrics& load = result.stages[0];
+    StageMetrics& indicators = result.stages[1];
+    StageMetrics& fusion = result.stages[2];
+    StageMetrics& inference = result.stages[3];
+    load.name = "load";
+    indicators.name = "indicators";
+    fusion.name = "fusion";
+    inference.name = "inference";
+
+    BatchQueue loaded(queue_capacity), computed(queue_capacity), fused(queue_capacity);
+    Clock::time_point start = Clock::now();
+
+    std::thread load_worker([&] {
+        for (size_t first = 0; first < csvFiles.size(); first += batch_size) {
+            Clock::time_point busy = Clock::now();
+            size_t last = std::min(csvFiles.size(), first + batch_size);
+            BatchPtr batch(new std::vector<SymbolWork>(last - first));
+            for (size_t i = first; i < last; ++i) {
+                SymbolWork& symbol = (*batch)[i - first];
+                symbol.index = i;
+                try {
+                    readPricesSupertrend(csvFiles[i].c_str(), symbol.series.high, symbol.series.low, symbol.series.close);
+                } catch (const std::exception& e) {
+                    std::cerr << "Error parsing file: " << csvFiles[i] << " (" << e.what() << ")" << std::endl;
+                    symbol.series = PriceSeries();
+                }
+            }
+            load.busy_seconds += seconds_since(busy);
+            load.batches++;
+            load.symbols += batch->size();
+            push_blocking(loaded, batch, load);
+        }
+        loaded.close();
+    });
+
+    std::thread indicator_worker([&] {
+        run_stage(loaded, &computed, indicators, csvFiles, [&](SymbolWork& symbol) {
+            if (symbol.series.close.empty()) return;
+            // Too short for the indicator warm-ups; left with an empty prediction like signal_server does
+            if (!fusion_params_valid(params, symbol.series.close.size())) {
+                std::cerr << "Skipping " << csvFiles[symbol.index] << ": " << symbol.series.close.size() << " rows are too few for the fusion parameters." << std::endl;
+                return;
+            }
+            symbol.signals = compute_strategy_signals(symbol.series, params);
+        });
+    });
+
+    std::thread fusion_worker([&] {
+        run_stage(computed, &fused, fusion, csvFiles, [&](SymbolWork& symbol) {
+            if (!symbol.signals.empty()) {
+                symbol.features = fuse_signals(symbol.signals, symbol.series.close.size(), symbol.rows);
+            }
+            symbol.signals.clear();
+            symbol.series = PriceSeries();
+        });
+    });
+
+    std::thread inference_worker([&] {
+        run_stage(fused, nullptr, inference, csvFiles, [&](SymbolWork& symbol) {
+            result.predictions[symbol.index] = model.predict(symbol.features, symbol.rows);
+        });
+    });
+
+    load_worker.join();
+    indicator_worker.join();
+    fusion_worker.join();
+    inference_worker.join();
+    result.wall_seconds = seconds_since(start);
+    return result;
+}
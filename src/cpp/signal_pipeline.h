@@ -0,0 +1,36 @@
+#ifndef SIGNAL_PIPELINE_H
+#define SIGNAL_PIPELINE_H
+
+#include <vector>
+#include <string>
+#include <cstddef>
+#include "fusion_model.h"
+
+// Per-stage counters collected by run_signal_pipeline.
+struct StageMetrics {
+    std::string name;
+    size_t batches = 0;
+    size_t symbols = 0;
+    double busy_seconds = 0.0;        // Doing the stage's own work
+    double input_wait_seconds = 0.0;  // Starved: input queue empty
+    double output_wait_seconds = 0.0; // Backpressure: output queue full
+
+    // Symbols processed per second of busy time.
+    double throughput() const { return busy_seconds > 0.0 ? symbols / busy_seconds : 0.0; }
+};
+
+struct PipelineResult {
+    std::vector<std::string> symbols;          // Input CSV files, in input order
+    std::vector<std::vector<int>> predictions; // Model predictions (-1, 0, 1) per symbol
+    std::vector<StageMetrics> stages;          // load, indicators, fusion, inference
+    double wall_seconds = 0.0;
+};
+
+// Scores a universe of CSV files with four overlapping stages, each on its own worker thread:
+//   load (readPricesSupertrend) -> indicators (nine strategy signals) -> fusion (feature rows)
+//   -> inference (FusionModel).
+// Stages exchange batches of batch_size symbols through bounded lock-free queues holding
+// queue_capacity batches each; a full queue stalls the upstream stage (backpressure).
+PipelineResult run_signal_pipeline(const std::vector<std::string>& csvFiles, const FusionModel& model, const FusionParams& params, size_t batch_size, size_t queue_capacity);
+
+#endif // SIGNAL_PIPELINE_H
@@ -0,0 +1,78 @@
+#ifndef SIGNAL_PROTOCOL_H
+#define SIGNAL_PROTOCOL_H
+
+#include <cstdint>
+#include <cstddef>
+#include <cerrno>
+#include <unistd.h>
+
+/*
+Binary protocol of the signal server (Unix domain socket, host byte order).
+
+Request:  RequestHeader, then symbol_len bytes of symbol name, then num_params doubles.
+          REQUEST_SIGNALS: 'strategy' is a StrategyId and params follow its run_* argument order.
+          REQUEST_PREDICT: params are the FusionParams fields in declaration order (or none).
+          num_params == 0 selects the defaults.
+Response: ResponseHeader, then count int32 values (signals, or -1/0/1 model predictions).
+
+A connection may carry any number of request/response pairs.
+*/
+
+const uint32_t SIGNAL_PROTOCOL_MAGIC = 0x53475354; // "TSGS"
+const uint16_t MAX_SYMBOL_LENGTH = 256;
+const uint32_t MAX_REQUEST_PARAMS = 16;
+
+enum RequestKind : uint8_t {
+    REQUEST_SIGNALS = 1,
+    REQUEST_PREDICT = 2
+};
+
+enum ResponseStatus : uint8_t {
+    STATUS_OK = 0,
+    STATUS_UNKNOWN_SYMBOL = 1,
+    STATUS_BAD_REQUEST = 2,
+    STATUS_NO_MODEL = 3
+};
+
+struct RequestHeader {
+    uint32_t magic;
+    uint8_t kind;
+    uint8_t strategy;
+    uint16_t symbol_len;
+    uint32_t num_params;
+};
+
+struct ResponseHeader {
+    uint32_t magic;
+    uint8_t status;
+    uint8_t reserved[3];
+    uint32_t count;
+};
+
+// Reads exactly 'size' bytes; returns false on EOF or error.
+inline bool read_full(int fd, void* data, size_t size) {
+    char* p = static_cast<char*>(data);
+    while (size > 0) {
+        ssize_t n = ::read(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+// Writes exactly 'size' bytes; returns false on error.
+inline bool write_full(int fd, const void* data, size_t size) {
+    const char* p = static_cast<const char*>(data);
+    while (size > 0) {
+        ssize_t n = ::write(fd, p, size);
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        p += n;
+        size -= (size_t)n;
+    }
+    return true;
+}
+
+#endif // SIGNAL_PROTOCOL_H
@@ -0,0 +1,375 @@
+#include "signal_protocol.h"
+#include "strategy_dispatch.h"
+#include "fusion_model.h"
+#include "supertrend_strategy.h"
+#include <iostream>
+#include <string>
+#include <vector>
+#include <map>
+#include <set>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <shared_mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cmath>
+#include <cstring>
+#include <cstdlib>
+#include <climits>
+#include <csignal>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+/*
+Resident signal server.
+
+Usage:
+    signal_server --socket /tmp/trisignal.sock [--weights models/nn_model_weights.txt]
+                  [--workers 4] [--memo 4096] [--timeout-ms 2000] SYMBOL=path/to/prices.csv [SYMBOL=...]
+
+Every listed CSV is parsed once at startup and the default fusion predictions are precomputed.
+Results for other strategies/parameters are computed on first request and kept in memory, so
+all clients share one warm copy; at most --memo results are kept, least recently used first out.
+The main thread polls the listening socket and all idle connections and queues each connection
+with a pending request for a pool of worker threads. A worker answers one request and hands the
+connection back, so any number of persistent clients share the pool fairly. Connections get a
+--timeout-ms receive and send timeout; a client that stalls mid-request or stops reading its
+responses is disconnected, so it can hold a worker for at most that long.
+*/
+
+namespace {
+
+const size_t DEFAULT_MAX_RESULTS = 4096;
+const int DEFAULT_CLIENT_TIMEOUT_MS = 2000;
+
+struct MemoEntry {
+    std::vector<int> values;
+    std::atomic<uint64_t> last_used{0};
+};
+
+struct ServerState {
+    std::map<std::string, PriceSeries> series;
+    FusionModel model;
+
+    // Computed responses keyed by symbol, request kind, strategy and raw parameter bytes. Hits only
+    // take the shared lock and stamp last_used; inserts past max_results evict the stalest entry.
+    std::map<std::string, MemoEntry> results;
+    std::shared_mutex results_mutex;
+    std::atomic<uint64_t> clock{0};
+    size_t max_results = DEFAULT_MAX_RESULTS;
+};
+
+std::atomic<bool> stopping(false);
+int wake_pipe[2] = {-1, -1};
+
+// Wakes up the poll() loop; also called from the signal handler, so only async-signal-safe calls.
+void wake_acceptor() {
+    char c = 0;
+    ssize_t ignored = ::write(wake_pipe[1], &c, 1);
+    (void)ignored;
+}
+
+void handle_stop_signal(int) {
+    stopping.store(true);
+    wake_acceptor();
+}
+
+std::string result_key(const std::string& symbol, const RequestHeader& header, const std::vector<double>& params) {
+    std::string key = symbol;
+    key.push_back('\0');
+    key.push_back((char)header.kind);
+    key.push_back((char)header.strategy);
+    key.append(reinterpret_cast<const char*>(params.data()), params.size() * sizeof(double));
+    return key;
+}
+
+// Reads FusionParams fields in declaration order. Values must be finite and fit an int before truncation;
+// fusion_params_valid() then checks them against the series.
+bool fusion_params_from(const std::vector<double>& p, FusionParams& params) {
+    if (p.empty()) return true;
+    if (p.size() != 8) return false;
+    for (double v : p) {
+        if (!std::isfinite(v) || std::fabs(v) > (double)INT_MAX) return false;
+    }
+    params.macd_short_period = (int)p[0];
+    params.macd_long_period = (int)p[1];
+    params.macd_signal_period = (int)p[2];
+    params.rsi_period = (int)p[3];
+    params.rsi_overbought = (int)p[4];
+    params.rsi_oversold = (int)p[5];
+    params.supertrend_period = (int)p[6];
+    params.supertrend_multiplier = p[7];
+    return true;
+}
+
+std::vector<int> compute_prediction(const ServerState& state, const PriceSeries& series, const FusionParams& params) {
+    size_t rows = 0;
+    std::vector<double> features = fuse_signals(compute_strategy_signals(series, params), series.close.size(), rows);
+    return state.model.predict(features, rows);
+}
+
+void memo_store(ServerState& state, const std::string& key, const std::vector<int>& values) {
+    std::unique_lock<std::shared_mutex> lock(state.results_mutex);
+    MemoEntry& entry = state.results[key];
+    entry.values = values;
+    entry.last_used.store(++state.clock);
+    while (state.results.size() > state.max_results) {
+        auto oldest = state.results.begin();
+        for (auto it = state.results.begin(); it != state.results.end(); ++it) {
+            if (it->second.last_used.load(std::memory_order_relaxed) < oldest->second.last_used.load(std::memory_order_relaxed)) {
+                oldest = it;
+            }
+        }
+        state.results.erase(oldest);
+    }
+}
+
+// Computes (or fetches) the response values for one request. Returns the response status.
+uint8_t serve_request(ServerState& state, const RequestHeader& header, const std::string& symbol, const std::vector<double>& params, std::vector<int>& values) {
+    auto it = state.series.find(symbol);
+    if (it == state.series.end()) return STATUS_UNKNOWN_SYMBOL;
+    const PriceSeries& series = it->second;
+
+    std::string key = result_key(symbol, header, params);
+    {
+        std::shared_lock<std::shared_mutex> lock(state.results_mutex);
+        auto cached = state.results.find(key);
+        if (cached != state.results.end()) {
+            cached->second.last_used.store(++state.clock, std::memory_order_relaxed);
+            values = cached->second.values;
+            return STATUS_OK;
+        }
+    }
+
+    // Reject parameters the strategies cannot run on this series instead of computing them
+    if (header.kind == REQUEST_SIGNALS) {
+        if (!run_strategy_on_series((StrategyId)header.strategy, series, params, values)) return STATUS_BAD_REQUEST;
+    } else if (header.kind == REQUEST_PREDICT) {
+        if (!state.model.loaded()) return STATUS_NO_MODEL;
+        FusionParams fusion_params;
+        if (!fusion_params_from(params, fusion_params) || !fusion_params_valid(fusion_params, series.close.size())) {
+            return STATUS_BAD_REQUEST;
+        }
+        values = compute_prediction(state, series, fusion_params);
+    } else {
+        return STATUS_BAD_REQUEST;
+    }
+
+    memo_store(state, key, values);
+    return STATUS_OK;
+}
+
+// Bounds how long a worker blocks in read_full/write_full on this connection (both then fail with EAGAIN).
+// Accepted sockets are blocking; they do not inherit O_NONBLOCK from the listening socket.
+bool set_client_timeout(int fd, int timeout_ms) {
+    timeval tv;
+    tv.tv_sec = timeout_ms / 1000;
+    tv.tv_usec = (timeout_ms % 1000) * 1000;
+    return ::setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv)) == 0 &&
+           ::setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &tv, sizeof(tv)) == 0;
+}
+
+// Reads and answers one request on a readable connection. Returns false if the client disconnected,
+// timed out or sent a malformed header, in which case the connection should be closed.
+bool serve_next_request(ServerState& state, int fd) {
+    RequestHeader header;
+    if (!read_full(fd, &header, sizeof(header))) return false;
+    if (header.magic != SIGNAL_PROTOCOL_MAGIC || header.symbol_len > MAX_SYMBOL_LENGTH || header.num_params > MAX_REQUEST_PARAMS) {
+        return false;
+    }
+    std::string symbol(header.symbol_len, '\0');
+    std::vector<double> params(header.num_params);
+    if (!read_full(fd, &symbol[0], symbol.size()) || !read_full(fd, params.data(), params.size() * sizeof(double))) {
+        return false;
+    }
+
+    std::vector<int> values;
+    ResponseHeader response = {SIGNAL_PROTOCOL_MAGIC, STATUS_OK, {0, 0, 0}, 0};
+    response.status = serve_request(state, header, symbol, params, values);
+    if (response.status != STATUS_OK) values.clear();
+    response.count = (uint32_t)values.size();
+    return write_full(fd, &response, sizeof(response)) && write_full(fd, values.data(), values.size() * sizeof(int32_t));
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string socket_path, weights_file;
+    size_t num_workers = std::max(1u, std::thread::hardware_concurrency());
+    int client_timeout_ms = DEFAULT_CLIENT_TIMEOUT_MS;
+    ServerState state;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--socket" && i + 1 < argc) {
+            socket_path = argv[++i];
+        } else if (arg == "--weights" && i + 1 < argc) {
+            weights_file = argv[++i];
+        } else if (arg == "--workers" && i + 1 < argc) {
+            num_workers = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--memo" && i + 1 < argc) {
+            state.max_results = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--timeout-ms" && i + 1 < argc) {
+            client_timeout_ms = std::max(1, std::atoi(argv[++i]));
+        } else if (arg.find('=') != std::string::npos) {
+            std::string symbol = arg.substr(0, arg.find('='));
+            std::string csvFile = arg.substr(arg.find('=') + 1);
+            PriceSeries& series = state.series[symbol];
+            readPricesSupertrend(csvFile.c_str(), series.high, series.low, series.close);
+            if (series.close.empty()) {
+                std::cerr << "No price data available for " << symbol << "." << std::endl;
+                return 1;
+            }
+        } else {
+            std::cerr << "Usage: " << argv[0] << " --socket PATH [--weights FILE] [--workers N] [--memo N] [--timeout-ms N] SYMBOL=file.csv..." << std::endl;
+            return 1;
+        }
+    }
+    if (socket_path.empty() || state.series.empty()) {
+        std::cerr << "Usage: " << argv[0] << " --socket PATH [--weights FILE] [--workers N] [--memo N] [--timeout-ms N] SYMBOL=file.csv..." << std::endl;
+        return 1;
+    }
+    if (!weights_file.empty() && !state.model.load(weights_file.c_str())) {
+        return 1;
+    }
+    if (state.model.loaded() && state.model.input_dim() != NUM_FUSION_FEATURES) {
+        std::cerr << "Fusion model expects " << state.model.input_dim() << " inputs, server produces " << NUM_FUSION_FEATURES << "." << std::endl;
+        return 1;
+    }
+
+    // Warm the default predictions for every symbol
+    if (state.model.loaded()) {
+        RequestHeader header = {SIGNAL_PROTOCOL_MAGIC, REQUEST_PREDICT, 0, 0, 0};
+        for (const auto& entry : state.series) {
+            if (!fusion_params_valid(FusionParams(), entry.second.close.size())) continue;
+            memo_store(state, result_key(entry.first, header, {}), compute_prediction(state, entry.second, FusionParams()));
+        }
+    }
+
+    sockaddr_un addr;
+    std::memset(&addr, 0, sizeof(addr));
+    addr.sun_family = AF_UNIX;
+    if (socket_path.size() >= sizeof(addr.sun_path)) {
+        std::cerr << "Socket path too long: " << socket_path << std::endl;
+        return 1;
+    }
+    std::strcpy(addr.sun_path, socket_path.c_str());
+    ::unlink(socket_path.c_str());
+    int listen_fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (listen_fd < 0 || ::bind(listen_fd, (sockaddr*)&addr, sizeof(addr)) != 0 || ::listen(listen_fd, 128) != 0) {
+        std::cerr << "Error listening on socket: " << socket_path << std::endl;
+        return 1;
+    }
+    if (::pipe(wake_pipe) != 0) {
+        std::cerr << "Error creating wake-up pipe." << std::endl;
+        return 1;
+    }
+    ::fcntl(wake_pipe[0], F_SETFL, O_NONBLOCK);
+    ::fcntl(wake_pipe[1], F_SETFL, O_NONBLOCK);
+    ::fcntl(listen_fd, F_SETFL, O_NONBLOCK);
+    std::signal(SIGPIPE, SIG_IGN);
+    std::signal(SIGINT, handle_stop_signal);
+    std::signal(SIGTERM, handle_stop_signal);
+
+    // Connections with a request waiting for a worker, connections handed back after a response,
+    // and the connections currently being served
+    std::deque<int> ready;
+    std::vector<int> returned;
+    std::set<int> active;
+    std::mutex queue_mutex;
+    std::condition_variable ready_cv;
+
+    std::vector<std::thread> workers;
+    for (size_t w = 0; w < num_workers; ++w) {
+        workers.emplace_back([&] {
+            while (true) {
+                int fd;
+                {
+                    std::unique_lock<std::mutex> lock(queue_mutex);
+                    ready_cv.wait(lock, [&] { return stopping.load() || !ready.empty(); });
+                    if (stopping.load()) return;
+                    fd = ready.front();
+                    ready.pop_front();
+                    active.insert(fd);
+                }
+                bool keep = serve_next_request(state, fd);
+                {
+                    std::lock_guard<std::mutex> lock(queue_mutex);
+                    active.erase(fd);
+                    if (keep && !stopping.load()) {
+                        returned.push_back(fd);
+                        fd = -1;
+                    }
+                }
+                if (fd >= 0) {
+                    ::close(fd);
+                } else {
+                    wake_acceptor();
+                }
+            }
+        });
+    }
+
+    // Slots 0 and 1 are the listening socket and the wake-up pipe; the rest are idle connections.
+    // A connection leaves the poll set while a worker serves its request.
+    std::vector<pollfd> polled = {{listen_fd, POLLIN, 0}, {wake_pipe[0], POLLIN, 0}};
+    std::cout << "Serving " << state.series.size() << " symbols on " << socket_path << " with " << num_workers << " workers" << std::endl;
+    while (!stopping.load()) {
+        if (::poll(polled.data(), polled.size(), -1) < 0) {
+            if (errno == EINTR) continue;
+            break;
+        }
+        if (polled[1].revents & POLLIN) {
+            char buffer[64];
+            while (::read(wake_pipe[0], buffer, sizeof(buffer)) > 0) {}
+        }
+
+        std::vector<pollfd> next(polled.begin(), polled.begin() + 2);
+        {
+            std::lock_guard<std::mutex> lock(queue_mutex);
+            for (size_t i = 2; i < polled.size(); ++i) {
+                if (polled[i].revents != 0) {
+                    ready.push_back(polled[i].fd); // Readable, hung up or failed: the worker finds out which
+                    ready_cv.notify_one();
+                } else {
+                    next.push_back(polled[i]);
+                }
+            }
+            for (int fd : returned) next.push_back({fd, POLLIN, 0});
+            returned.clear();
+        }
+        if (polled[0].revents & POLLIN) {
+            int fd;
+            while ((fd = ::accept(listen_fd, nullptr, nullptr)) >= 0) {
+                if (!set_client_timeout(fd, client_timeout_ms)) {
+                    ::close(fd);
+                    continue;
+                }
+                next.push_back({fd, POLLIN, 0});
+            }
+        }
+        polled.swap(next);
+    }
+
+    // Shut down: stop accepting, disconnect clients still being served, close idle and queued connections
+    stopping.store(true);
+    {
+        std::lock_guard<std::mutex> lock(queue_mutex);
+        for (int fd : active) ::shutdown(fd, SHUT_RDWR);
+    }
+    ready_cv.notify_all();
+    for (std::thread& w : workers) w.join();
+    for (size_t i = 2; i < polled.size(); ++i) ::close(polled[i].fd);
+    for (int fd : ready) ::close(fd);
+    for (int fd : returned) ::close(fd);
+    ::close(wake_pipe[0]);
+    ::close(wake_pipe[1]);
+    ::close(listen_fd);
+    ::unlink(socket_path.c_str());
+    return 0;
+}
@@ -0,0 +1,113 @@
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstddef>
+#include <utility>
+
+// Bounded lock-free single-producer / single-consumer ring buffer.
+// One slot is kept empty to tell "full" from "empty", so the buffer holds capacity + 1 slots.
+// The producer calls close() after its last push; the consumer drains what is left.
+// push() / pop() spin briefly and then park on a condition variable until the other side makes
+// progress, so an idle stage does not burn a core. The ring itself stays lock-free: the mutex is
+// only taken to park, or to wake a side that is parked.
+template <typename T>
+class SpscQueue {
+public:
+    explicit SpscQueue(size_t capacity) : slots(capacity + 1) {}
+
+    // Moves 'item' into the queue. Returns false (leaving 'item' untouched) if the queue is full.
+    bool try_push(T& item) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        size_t next = (t + 1) % slots.size();
+        if (next == head.load(std::memory_order_acquire)) return false;
+        slots[t] = std::move(item);
+        tail.store(next, std::memory_order_release);
+        wake(consumer_parked);
+        return true;
+    }
+
+    // Moves the oldest element into 'item'. Returns false if the queue is empty.
+    bool try_pop(T& item) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+        item = std::move(slots[h]);
+        head.store((h + 1) % slots.size(), std::memory_order_release);
+        wake(producer_parked);
+        return true;
+    }
+
+    // Moves 'item' into the queue, waiting while it is full.
+    void push(T& item) {
+        for (int spin = 0; !try_push(item); ++spin) {
+            if (spin < SPIN_LIMIT) {
+                std::this_thread::yield();
+            } else {
+                park(producer_parked, [&] { return (tail.load(std::memory_order_relaxed) + 1) % slots.size() != head.load(std::memory_order_acquire); });
+            }
+        }
+    }
+
+    // Moves the oldest element into 'item', waiting while the queue is empty.
+    // Returns false once the queue is closed and drained.
+    bool pop(T& item) {
+        for (int spin = 0; !try_pop(item); ++spin) {
+            // The producer may have pushed its last element just before closing
+            if (closed()) return try_pop(item);
+            if (spin < SPIN_LIMIT) {
+                std::this_thread::yield();
+            } else {
+                park(consumer_parked, [&] { return head.load(std::memory_order_relaxed) != tail.load(std::memory_order_acquire) || closed(); });
+            }
+        }
+        return true;
+    }
+
+    // Marks the end of the stream; called by the producer.
+    void close() {
+        done.store(true, std::memory_order_release);
+        wake(consumer_parked);
+    }
+
+    // True once the producer has closed the queue (elements may still be queued).
+    bool closed() const { return done.load(std::memory_order_acquire); }
+
+    size_t capacity() const { return slots.size() - 1; }
+
+private:
+    // Yields before parking; covers the common case of the other side being mid-batch.
+    static const int SPIN_LIMIT = 64;
+
+    // The seq_cst fences pair up with park(): either the waker sees the parked flag, or the parked
+    // side's predicate sees the waker's head/tail/done store.
+    void wake(std::atomic<bool>& parked) {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (parked.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(park_mutex);
+            park_cv.notify_all();
+        }
+    }
+
+    template <typename Ready>
+    void park(std::atomic<bool>& parked, Ready ready) {
+        std::unique_lock<std::mutex> lock(park_mutex);
+        parked.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        park_cv.wait(lock, ready);
+        parked.store(false, std::memory_order_relaxed);
+    }
+
+    std::vector<T> slots;
+    alignas(64) std::atomic<size_t> head{0}; // Next slot to pop (owned by the consumer)
+    alignas(64) std::atomic<size_t> tail{0}; // Next slot to fill (owned by the producer)
+    std::atomic<bool> done{false};
+    std::atomic<bool> producer_parked{false}, consumer_parked{false};
+    std::mutex park_mutex;
+    std::condition_variable park_cv;
+};
+
+#endif // SPSC_QUEUE_H
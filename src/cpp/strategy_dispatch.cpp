@@ -0,0 +1,151 @@
+#include "strategy_dispatch.h"
+#include "macd_strategy.h"
+#include "rsi_strategy.h"
+#include "supertrend_strategy.h"
+#include "combined_strategy.h"
+#include <vector>
+#include <cstring>
+#include <cmath>
+
+namespace {
+
+const char* const STRATEGY_NAMES[NUM_STRATEGIES] = {
+    "macd", "rsi", "supertrend", "macd_rsi_swing", "advanced_parameter_optimization",
+    "mean_reversion", "momentum_breakout", "multi_timeframe", "adaptive_ensemble", "dynamic_parameter"
+};
+
+// Default parameters per strategy, matching the binding defaults and generate_dataset.py
+const std::vector<double> DEFAULT_PARAMS[NUM_STRATEGIES] = {
+    {7, 54, 8},               // MACD: short, long, signal
+    {4, 99, 43},              // RSI: period, overbought, oversold
+    {5, 8.5},                 // Supertrend: period, multiplier
+    {7, 54, 8, 4},            // MACD + RSI Swing
+    {7, 54, 8, 4, 5, 8.5},    // Advanced Parameter Optimization
+    {4, 5, 8.5},              // Mean Reversion: rsi period, supertrend period, multiplier
+    {7, 54, 8, 4, 5, 8.5},    // Momentum Breakout
+    {7, 54, 8, 4, 5, 8.5},    // Multi-Timeframe
+    {7, 54, 8, 4, 5, 8.5},    // Adaptive Ensemble
+    {7, 54, 8, 4, 5, 8.5},    // Dynamic Parameter
+};
+
+// Periods index into the series, so they must be at least 1 after truncation and shorter than it
+bool period_valid(double value, size_t series_length) {
+    return std::isfinite(value) && value >= 1.0 && value < (double)series_length;
+}
+
+// calculate_macd() seeds the signal EMA from the first 'signal' MACD values, of which there are
+// series_length - long + 1. 'slack' covers strategies that lengthen the periods themselves.
+bool macd_params_valid(double short_period, double long_period, double signal_period, int slack, size_t series_length) {
+    if (!period_valid(short_period, series_length) || !period_valid(long_period, series_length) ||
+        !period_valid(signal_period, series_length)) {
+        return false;
+    }
+    return (int)short_period < (int)long_period &&
+           (size_t)((int)long_period + slack + (int)signal_period) <= series_length;
+}
+
+bool supertrend_params_valid(double period, double multiplier, size_t series_length) {
+    return period_valid(period, series_length) && std::isfinite(multiplier);
+}
+
+bool rsi_threshold_valid(double value) {
+    return std::isfinite(value) && value >= 0.0 && value <= 100.0;
+}
+
+} // namespace
+
+bool strategy_from_name(const char* name, StrategyId& id) {
+    for (int i = 0; i < NUM_STRATEGIES; ++i) {
+        if (std::strcmp(name, STRATEGY_NAMES[i]) == 0) {
+            id = (StrategyId)i;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t strategy_param_count(StrategyId id) {
+    return id < NUM_STRATEGIES ? DEFAULT_PARAMS[id].size() : 0;
+}
+
+bool strategy_params_valid(StrategyId id, const std::vector<double>& params, size_t series_length) {
+    if (id >= NUM_STRATEGIES) return false;
+    const std::vector<double>& p = params.empty() ? DEFAULT_PARAMS[id] : params;
+    if (p.size() != DEFAULT_PARAMS[id].size()) return false;
+
+    switch (id) {
+    case STRATEGY_MACD:
+        return macd_params_valid(p[0], p[1], p[2], 0, series_length);
+    case STRATEGY_RSI:
+        return period_valid(p[0], series_length) && rsi_threshold_valid(p[1]) && rsi_threshold_valid(p[2]);
+    case STRATEGY_SUPERTREND:
+        return supertrend_params_valid(p[0], p[1], series_length);
+    case STRATEGY_MACD_RSI_SWING:
+        return macd_params_valid(p[0], p[1], p[2], 0, series_length) && period_valid(p[3], series_length);
+    case STRATEGY_MEAN_REVERSION:
+        return period_valid(p[0], series_length) && supertrend_params_valid(p[1], p[2], series_length);
+    case STRATEGY_DYNAMIC_PARAMETER:
+        // Widens the MACD periods by up to +2 / +4 in low-volatility bars
+        return macd_params_valid(p[0], p[1], p[2], 4, series_length) && period_valid(p[3], series_length) &&
+               supertrend_params_valid(p[4], p[5], series_length);
+    case STRATEGY_ADVANCED_PARAMETER_OPTIMIZATION:
+    case STRATEGY_MOMENTUM_BREAKOUT:
+    case STRATEGY_MULTI_TIMEFRAME:
+    case STRATEGY_ADAPTIVE_ENSEMBLE:
+        return macd_params_valid(p[0], p[1], p[2], 0, series_length) && period_valid(p[3], series_length) &&
+               supertrend_params_valid(p[4], p[5], series_length);
+    default:
+        return false;
+    }
+}
+
+bool fusion_params_valid(const FusionParams& p, size_t series_length) {
+    return macd_params_valid(p.macd_short_period, p.macd_long_period, p.macd_signal_period, 0, series_length) &&
+           period_valid(p.rsi_period, series_length) &&
+           rsi_threshold_valid(p.rsi_overbought) && rsi_threshold_valid(p.rsi_oversold) &&
+           supertrend_params_valid(p.supertrend_period, p.supertrend_multiplier, series_length);
+}
+
+bool run_strategy_on_series(StrategyId id, const PriceSeriesView& series, const std::vector<double>& params, std::vector<int>& signals) {
+    if (!strategy_params_valid(id, params, series.close.size())) return false;
+    const std::vector<double>& p = params.empty() ? DEFAULT_PARAMS[id] : params;
+
+    SeriesView high = series.high;
+    SeriesView low = series.low;
+    SeriesView close = series.close;
+    switch (id) {
+    case STRATEGY_MACD:
+        signals = generate_macd_signals(close, (int)p[0], (int)p[1], (int)p[2]);
+        break;
+    case STRATEGY_RSI:
+        signals = generate_rsi_signals(close, (int)p[0], (int)p[1], (int)p[2]);
+        break;
+    case STRATEGY_SUPERTREND:
+        signals = generate_supertrend_signals(high, low, close, (int)p[0], p[1]);
+        break;
+    case STRATEGY_MACD_RSI_SWING:
+        signals = generate_macd_rsi_swing_signals(close, (int)p[0], (int)p[1], (int)p[2], (int)p[3]);
+        break;
+    case STRATEGY_ADVANCED_PARAMETER_OPTIMIZATION:
+        signals = generate_advanced_parameter_optimization_signals(high, low, close, (int)p[0], (int)p[1], (int)p[2], (int)p[3], (int)p[4], p[5]);
+        break;
+    case STRATEGY_MEAN_REVERSION:
+        signals = generate_mean_reversion_signals(high, low, close, (int)p[0], (int)p[1], p[2]);
+        break;
+    case STRATEGY_MOMENTUM_BREAKOUT:
+        signals = generate_momentum_breakout_signals(high, low, close, (int)p[0], (int)p[1], (int)p[2], (int)p[3], (int)p[4], p[5]);
+        break;
+    case STRATEGY_MULTI_TIMEFRAME:
+        signals = generate_multi_timeframe_signals(high, low, close, (int)p[0], (int)p[1], (int)p[2], (int)p[3], (int)p[4], p[5]);
+        break;
+    case STRATEGY_ADAPTIVE_ENSEMBLE:
+        signals = generate_adaptive_ensemble_signals(high, low, close, (int)p[0], (int)p[1], (int)p[2], (int)p[3], (int)p[4], p[5]);
+        break;
+    case STRATEGY_DYNAMIC_PARAMETER:
+        signals = generate_dynamic_parameter_signals(high, low, close, (int)p[0], (int)p[1], (int)p[2], (int)p[3], (int)p[4], p[5]);
+        break;
+    default:
+        return false;
+    }
+    return true;
+}
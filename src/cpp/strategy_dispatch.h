@@ -0,0 +1,43 @@
+#ifndef STRATEGY_DISPATCH_H
+#define STRATEGY_DISPATCH_H
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "data_types.h"
+#include "fusion_model.h"
+
+// Numeric strategy ids, used where strategies are selected at runtime (e.g. the signal server protocol).
+enum StrategyId : uint8_t {
+    STRATEGY_MACD = 0,
+    STRATEGY_RSI = 1,
+    STRATEGY_SUPERTREND = 2,
+    STRATEGY_MACD_RSI_SWING = 3,
+    STRATEGY_ADVANCED_PARAMETER_OPTIMIZATION = 4,
+    STRATEGY_MEAN_REVERSION = 5,
+    STRATEGY_MOMENTUM_BREAKOUT = 6,
+    STRATEGY_MULTI_TIMEFRAME = 7,
+    STRATEGY_ADAPTIVE_ENSEMBLE = 8,
+    STRATEGY_DYNAMIC_PARAMETER = 9,
+    NUM_STRATEGIES = 10
+};
+
+// Looks up a strategy id by its short name ("macd", "rsi", "supertrend", "macd_rsi_swing", ...).
+bool strategy_from_name(const char* name, StrategyId& id);
+
+// Number of parameters the strategy takes, in the order of its run_* function.
+size_t strategy_param_count(StrategyId id);
+
+// Checks that 'params' (or the defaults, if empty) can be run on a series of 'series_length' bars: periods must be
+// integers >= 1 that fit in the series, MACD needs short < long and long + signal <= series_length.
+bool strategy_params_valid(StrategyId id, const std::vector<double>& params, size_t series_length);
+
+// Same checks for the strategy parameters behind the fusion features.
+bool fusion_params_valid(const FusionParams& params, size_t series_length);
+
+// Runs a strategy on an in-memory (or shared-memory) series. 'params' follows the run_* argument order; an empty
+// vector selects the defaults used by bindings.cpp and generate_dataset.py.
+// Returns false if the id is unknown or the parameters fail strategy_params_valid().
+bool run_strategy_on_series(StrategyId id, const PriceSeriesView& series, const std::vector<double>& params, std::vector<int>& signals);
+
+#endif // STRATEGY_DISPATCH_H
@@ -35,7 +35,7 @@ void readPricesSupertrend(const char* csvFile, std::vector<double>& high, std::v
 
 // Real Supertrend calculation using standard formulas with exponential ATR.
 // Returns a vector of Supertrend values for the available bars (starting from index = period).
-std::vector<double> calculateSupertrend(const std::vector<double>& high, const std::vector<double>& low, const std::vector<double>& close, int period, double multiplier) {
+std::vector<double> calculateSupertrend(SeriesView high, SeriesView low, SeriesView close, int period, double multiplier) {
     size_t len = close.size();
     if (len < period + 1) {
         std::cerr << "Not enough data for Supertrend calculation." << std::endl;
@@ -107,6 +107,11 @@ std::vector<double> calculateSupertrend(const std::vector<double>& high, const s
 std::vector<int> run_supertrend_strategy(const char* csvFile, int period = 7, double multiplier = 3.0) {
     std::vector<double> high, low, close;
     readPricesSupertrend(csvFile, high, low, close);
+    return generate_supertrend_signals(high, low, close, period, multiplier);
+}
+
+// Generates Supertrend signals from High, Low and Close series
+std::vector<int> generate_supertrend_signals(SeriesView high, SeriesView low, SeriesView close, int period, double multiplier) {
     if (close.size() < (size_t)period) {
         std::cerr << "Not enough data for Supertrend calculation." << std::endl;
         return {};
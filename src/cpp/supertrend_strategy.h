@@ -4,6 +4,8 @@
 #include <vector>
 #include <cmath>
 #include <iostream>
+#include "data_types.h"
+#include "parallel_scan.h"
 
 // Runs the Supertrend strategy on the given CSV file with dynamic parameters.
 std::vector<int> run_supertrend_strategy(const char* csvFile, int period, double multiplier);
@@ -17,7 +19,7 @@ inline double trueRange(double currentHigh, double currentLow, double previousCl
 }
 
 // Inline function: Calculate ATR using exponential smoothing over 'period'
-inline std::vector<double> calculateATR_exponential(const std::vector<double>& high, const std::vector<double>& low, const std::vector<double>& close, int period) {
+inline std::vector<double> calculateATR_exponential(SeriesView high, SeriesView low, SeriesView close, int period) {
     std::vector<double> tr;
     // Compute True Range for each bar starting from index 1
     for (size_t i = 1; i < high.size(); ++i) {
@@ -37,7 +39,12 @@ inline std::vector<double> calculateATR_exponential(const std::vector<double>& h
     double prev_atr = sum / period;
     atr.push_back(prev_atr);
     
-    // Exponential smoothing for subsequent ATR values
+    // Exponential smoothing for subsequent ATR values (parallel scan for very long series)
+    if (tr.size() >= period + PARALLEL_SCAN_THRESHOLD) {
+        atr.resize(tr.size() - period + 1);
+        parallel_wilder(&tr[period], &atr[1], tr.size() - period, period, prev_atr);
+        return atr;
+    }
     for (size_t i = period; i < tr.size(); ++i) {
         double current_atr = (prev_atr * (period - 1) + tr[i]) / period;
         atr.push_back(current_atr);
@@ -48,6 +55,9 @@ inline std::vector<double> calculateATR_exponential(const std::vector<double>& h
 
 void readPricesSupertrend(const char* csvFile, std::vector<double>& high, std::vector<double>& low, std::vector<double>& close);
 
-std::vector<double> calculateSupertrend(const std::vector<double>& high, const std::vector<double>& low, const std::vector<double>& close, int period, double multiplier);
+// Generates Supertrend signals from in-memory High, Low and Close series.
+std::vector<int> generate_supertrend_signals(SeriesView high, SeriesView low, SeriesView close, int period, double multiplier);
+
+std::vector<double> calculateSupertrend(SeriesView high, SeriesView low, SeriesView close, int period, double multiplier);
 
 #endif // SUPERTREND_STRATEGY_H
@@ -1,98 +1,135 @@
+import os
+import math
+import tempfile
 import pandas as pd
 import bindings
 from itertools import product
 
+# Parameters backtest_strategy fills in when a key is missing from params
+COMBINED_DEFAULTS = {
+    "macd_short_period": 7,
+    "macd_long_period": 54,
+    "macd_signal_period": 8,
+    "rsi_period": 4,
+    "supertrend_period": 5,
+    "supertrend_multiplier": 8.5,
+}
+STRATEGY_DEFAULTS = {
+    "MACD": {"short_period": 12, "long_period": 26, "signal_period": 9},
+    "RSI": {"period": 14, "overbought": 70, "oversold": 30},
+    "Supertrend": {"period": 10, "multiplier": 3.0},
+    "MACD + RSI Swing Reversal": {key: COMBINED_DEFAULTS[key] for key in ("macd_short_period", "macd_long_period", "macd_signal_period", "rsi_period")},
+    "Advanced Parameter Optimization": COMBINED_DEFAULTS,
+    "Mean Reversion": {key: COMBINED_DEFAULTS[key] for key in ("rsi_period", "supertrend_period", "supertrend_multiplier")},
+    "Momentum Breakout": COMBINED_DEFAULTS,
+    "Multi-Timeframe": COMBINED_DEFAULTS,
+    "Adaptive Ensemble": COMBINED_DEFAULTS,
+    "Dynamic Parameter": COMBINED_DEFAULTS,
+}
+
+# Series length below which the combined strategies return no signals (see combined_strategy.cpp)
+STRATEGY_MIN_ROWS = {
+    "Advanced Parameter Optimization": 20,
+    "Mean Reversion": 20,
+    "Momentum Breakout": 20,
+    "Multi-Timeframe": 200,
+    "Adaptive Ensemble": 20,
+    "Dynamic Parameter": 20,
+}
+
 def backtest_strategy(strategy_name, csv_file, params=None):
     """
     Backtest a given strategy and calculate performance metrics.
     """
+    params = {**STRATEGY_DEFAULTS.get(strategy_name, {}), **(params or {})}
+
     # Load price data
     data = pd.read_csv(csv_file)
     prices = data['Close'].values
 
     # Generate signals using the strategy
     if strategy_name == "MACD":
-        short_period = params.get("short_period", 12)
-        long_period = params.get("long_period", 26)
-        signal_period = params.get("signal_period", 9)
+        short_period = params["short_period"]
+        long_period = params["long_period"]
+        signal_period = params["signal_period"]
         signals = bindings.run_macd_strategy(csv_file, short_period, long_period, signal_period)
         offset = long_period  # MACD offset is determined by the long_period
     elif strategy_name == "RSI":
-        period = params.get("period", 14)
-        overbought = params.get("overbought", 70)
-        oversold = params.get("oversold", 30)
+        period = params["period"]
+        overbought = params["overbought"]
+        oversold = params["oversold"]
         signals = bindings.run_rsi_strategy(csv_file, period, overbought, oversold)
         offset = period  # RSI offset is determined by the period
     elif strategy_name == "Supertrend":
-        period = params.get("period", 10)
-        multiplier = params.get("multiplier", 3.0)
+        period = params["period"]
+        multiplier = params["multiplier"]
         signals = bindings.run_supertrend_strategy(csv_file, period, multiplier)
         offset = period  # Supertrend offset is determined by the period
     elif strategy_name == "MACD + RSI Swing Reversal":
-        macd_short_period = params.get("macd_short_period", 7)
-        macd_long_period = params.get("macd_long_period", 54)
-        macd_signal_period = params.get("macd_signal_period", 8)
-        rsi_period = params.get("rsi_period", 4)
+        macd_short_period = params["macd_short_period"]
+        macd_long_period = params["macd_long_period"]
+        macd_signal_period = params["macd_signal_period"]
+        rsi_period = params["rsi_period"]
         signals = bindings.run_macd_rsi_swing_strategy(csv_file, macd_short_period, macd_long_period,
                                                        macd_signal_period, rsi_period)
         offset = max(macd_long_period, rsi_period)
     elif strategy_name == "Advanced Parameter Optimization":
-        macd_short_period = params.get("macd_short_period", 7)
-        macd_long_period = params.get("macd_long_period", 54)
-        macd_signal_period = params.get("macd_signal_period", 8)
-        rsi_period = params.get("rsi_period", 4)
-        supertrend_period = params.get("supertrend_period", 5)
-        supertrend_multiplier = params.get("supertrend_multiplier", 8.5)
+        macd_short_period = params["macd_short_period"]
+        macd_long_period = params["macd_long_period"]
+        macd_signal_period = params["macd_signal_period"]
+        rsi_period = params["rsi_period"]
+        supertrend_period = params["supertrend_period"]
+        supertrend_multiplier = params["supertrend_multiplier"]
         signals = bindings.run_advanced_parameter_optimization_strategy(csv_file, macd_short_period, macd_long_period,
                                                                         macd_signal_period, rsi_period, supertrend_period,
                                                                         supertrend_multiplier)
         offset = max(macd_long_period, rsi_period, supertrend_period)
     elif strategy_name == "Mean Reversion":
-        rsi_period = params.get("rsi_period", 4)
-        supertrend_period = params.get("supertrend_period", 5)
-        supertrend_multiplier = params.get("supertrend_multiplier", 8.5)
+        rsi_period = params["rsi_period"]
+        supertrend_period = params["supertrend_period"]
+        supertrend_multiplier = params["supertrend_multiplier"]
         signals = bindings.run_mean_reversion_strategy(csv_file, rsi_period, supertrend_period, supertrend_multiplier)
         offset = max(rsi_period, supertrend_period)
     elif strategy_name == "Momentum Breakout":
-        macd_short_period = params.get("macd_short_period", 7)
-        macd_long_period = params.get("macd_long_period", 54)
-        macd_signal_period = params.get("macd_signal_period", 8)
-        rsi_period = params.get("rsi_period", 4)
-        supertrend_period = params.get("supertrend_period", 5)
-        supertrend_multiplier = params.get("supertrend_multiplier", 8.5)
+        macd_short_period = params["macd_short_period"]
+        macd_long_period = params["macd_long_period"]
+        macd_signal_period = params["macd_signal_period"]
+        rsi_period = params["rsi_period"]
+        supertrend_period = params["supertrend_period"]
+        supertrend_multiplier = params["supertrend_multiplier"]
         signals = bindings.run_momentum_breakout_strategy(csv_file, macd_short_period, macd_long_period,
                                                           macd_signal_period, rsi_period, supertrend_period,
                                                           supertrend_multiplier)
         offset = max(macd_long_period, rsi_period, supertrend_period)
     elif strategy_name == "Multi-Timeframe":
-        macd_short_period = params.get("macd_short_period", 7)
-        macd_long_period = params.get("macd_long_period", 54)
-        macd_signal_period = params.get("macd_signal_period", 8)
-        rsi_period = params.get("rsi_period", 4)
-        supertrend_period = params.get("supertrend_period", 5)
-        supertrend_multiplier = params.get("supertrend_multiplier", 8.5)
+        macd_short_period = params["macd_short_period"]
+        macd_long_period = params["macd_long_period"]
+        macd_signal_period = params["macd_signal_period"]
+        rsi_period = params["rsi_period"]
+        supertrend_period = params["supertrend_period"]
+        supertrend_multiplier = params["supertrend_multiplier"]
         signals = bindings.run_multi_timeframe_strategy(csv_file, macd_short_period, macd_long_period,
                                                         macd_signal_period, rsi_period, supertrend_period,
                                                         supertrend_multiplier)
         offset = max(macd_long_period, rsi_period, supertrend_period)
     elif strategy_name == "Adaptive Ensemble":
-        macd_short_period = params.get("macd_short_period", 7)
-        macd_long_period = params.get("macd_long_period", 54)
-        macd_signal_period = params.get("macd_signal_period", 8)
-        rsi_period = params.get("rsi_period", 4)
-        supertrend_period = params.get("supertrend_period", 5)
-        supertrend_multiplier = params.get("supertrend_multiplier", 8.5)
+        macd_short_period = params["macd_short_period"]
+        macd_long_period = params["macd_long_period"]
+        macd_signal_period = params["macd_signal_period"]
+        rsi_period = params["rsi_period"]
+        supertrend_period = params["supertrend_period"]
+        supertrend_multiplier = params["supertrend_multiplier"]
         signals = bindings.run_adaptive_ensemble_strategy(csv_file, macd_short_period, macd_long_period,
                                                           macd_signal_period, rsi_period, supertrend_period,
                                                           supertrend_multiplier)
         offset = max(macd_long_period, rsi_period, supertrend_period)
     elif strategy_name == "Dynamic Parameter":
-        macd_short_period = params.get("macd_short_period", 7)
-        macd_long_period = params.get("macd_long_period", 54)
-        macd_signal_period = params.get("macd_signal_period", 8)
-        rsi_period = params.get("rsi_period", 4)
-        supertrend_period = params.get("supertrend_period", 5)
-        supertrend_multiplier = params.get("supertrend_multiplier", 8.5)
+        macd_short_period = params["macd_short_period"]
+        macd_long_period = params["macd_long_period"]
+        macd_signal_period = params["macd_signal_period"]
+        rsi_period = params["rsi_period"]
+        supertrend_period = params["supertrend_period"]
+        supertrend_multiplier = params["supertrend_multiplier"]
         signals = bindings.run_dynamic_parameter_strategy(csv_file, macd_short_period, macd_long_period,
                                                           macd_signal_period, rsi_period, supertrend_period,
                                                           supertrend_multiplier)
@@ -187,6 +224,75 @@ def backtest_multiple_params(strategy_name, csv_file, param_grid):
 
     return best_params, best_score, results
 
+def warmup_rows(strategy_name, params, margin=1):
+    """
+    Shortest history a strategy can be scored on with a parameter set, after filling in the same defaults
+    as backtest_strategy: margin times the indicator warm-up (every period must fit in the series, and MACD
+    needs long + signal bars plus 4 for the Dynamic Parameter widening), and at least the strategy's
+    STRATEGY_MIN_ROWS.
+    """
+    params = {**STRATEGY_DEFAULTS.get(strategy_name, {}), **params}
+    periods = [value for key, value in params.items() if key.endswith("period")]
+    macd = params.get("long_period", params.get("macd_long_period", 0)) + params.get("signal_period", params.get("macd_signal_period", 0))
+    warmup = max(max(periods, default=0) + 1, macd + 4 if macd else 0)
+    return max(margin * warmup, STRATEGY_MIN_ROWS.get(strategy_name, 0))
+
+def backtest_successive_halving(strategy_name, csv_file, param_grid, min_fraction=0.125, keep_ratio=0.5, min_rows=250):
+    """
+    Successive-halving search over a parameter grid.
+    Every combination is first backtested on a prefix of min_fraction of the history (at least min_rows rows).
+    Only the top keep_ratio of combinations survive each rung, and the prefix grows by 1 / keep_ratio,
+    until the survivors are scored on the full history.
+    A combination is only scored once the prefix holds warmup_rows with a margin of 2, so long periods are
+    never run past the end of a short prefix and strategies are never scored below their minimum length;
+    until then it is carried to the next rung unscored. Combinations that do not fit in the full history
+    are dropped.
+    """
+    if not 0.0 < keep_ratio < 1.0:
+        raise ValueError("keep_ratio must be between 0 and 1")
+    if not 0.0 < min_fraction <= 1.0:
+        raise ValueError("min_fraction must be in (0, 1]")
+
+    data = pd.read_csv(csv_file)
+    total_rows = len(data)
+    candidates = [dict(zip(param_grid.keys(), values)) for values in product(*param_grid.values())]
+    fraction = max(min_fraction, min_rows / max(total_rows, 1))
+
+    with tempfile.TemporaryDirectory() as tmp_dir:
+        while True:
+            rows = min(total_rows, int(total_rows * fraction))
+            if rows < total_rows:
+                # Strategies read from CSV, so each rung gets its own prefix file
+                rung_file = os.path.join(tmp_dir, f"prefix_{rows}.csv")
+                data.iloc[:rows].to_csv(rung_file, index=False)
+            else:
+                rung_file = csv_file
+
+            # A prefix must hold twice a combination's warm-up before it is scored; the full history only the warm-up
+            margin = 1 if rows >= total_rows else 2
+            ready = [params for params in candidates if warmup_rows(strategy_name, params, margin) <= rows]
+            deferred = [params for params in candidates if warmup_rows(strategy_name, params, margin) > rows]
+            if rows >= total_rows and deferred:
+                print(f"Skipping {len(deferred)} parameter combinations longer than the {total_rows}-row history.")
+
+            scored = []
+            for params in ready:
+                results = backtest_strategy(strategy_name, rung_file, params)
+                # Scoring function: Success Rate * Average Return
+                score = results["Success Rate"] * results["Average Return per Trade"]
+                scored.append((score, params, results))
+            scored.sort(key=lambda entry: entry[0], reverse=True)
+
+            if rows >= total_rows:
+                if not scored:
+                    return None, -float('inf'), None
+                best_score, best_params, best_results = scored[0]
+                return best_params, best_score, best_results
+
+            keep = math.ceil(len(scored) * keep_ratio)
+            candidates = [params for _, params, _ in scored[:keep]] + deferred
+            fraction /= keep_ratio
+
 if __name__ == "__main__":
     csv_file = "data/AAPL_testing.csv"
 
@@ -0,0 +1,32 @@
+import os
+os.environ['TF_CPP_MIN_LOG_LEVEL'] = '2'  # Suppress TensorFlow warnings
+
+import argparse
+from tensorflow.keras.models import load_model
+from tensorflow.keras.layers import Dense
+
+def export_weights(model_file, output_file):
+    """
+    Export the Dense layers of a trained Keras model to the text format read by the C++ FusionModel.
+    Dropout layers are skipped since they are identity at inference.
+    """
+    model = load_model(model_file)
+    dense_layers = [layer for layer in model.layers if isinstance(layer, Dense)]
+
+    with open(output_file, 'w') as f:
+        f.write(f"fusion-mlp {len(dense_layers)}\n")
+        for layer in dense_layers:
+            kernel, bias = layer.get_weights()
+            activation = layer.get_config()['activation']
+            f.write(f"{kernel.shape[0]} {kernel.shape[1]} {activation}\n")
+            f.write(' '.join(repr(float(w)) for w in kernel.flatten()) + '\n')
+            f.write(' '.join(repr(float(b)) for b in bias) + '\n')
+
+    print(f"Weights exported to {output_file}")
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser()
+    parser.add_argument('--model', default='models/nn_model_weights.h5', help="Path to the trained Keras model")
+    parser.add_argument('--output', default='models/nn_model_weights.txt', help="Path to the exported weights file")
+    args = parser.parse_args()
+    export_weights(args.model, args.output)